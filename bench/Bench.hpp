@@ -0,0 +1,47 @@
+/**
+   @file
+   @brief Minimal timing support shared by the benchmarks
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+   The benchmarks are host-only and require C++11 (for <chrono>).  Each is a
+   single translation unit, built by the Makefile in this directory or e.g.:
+
+       g++ -O2 -std=c++11 -I../src FixedLengthListDequeueBench.cpp
+
+*/
+
+#if !defined BENCH_HPP
+#define      BENCH_HPP
+
+#include <chrono>
+#include <cstdint>
+
+/** Monotonic time stamp in nanoseconds */
+static inline uint64_t bench_now_ns( void )
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+/** Values written here are treated as observable, preventing the compiler
+    from optimising away the work being measured */
+static volatile uint64_t bench_sink;
+
+#endif
@@ -0,0 +1,204 @@
+/**
+   @file
+   @brief Benchmark of a consumer thread taking items from
+          FixedLengthBlockingList with pop_wait() and pop_wait_n(), compared
+          with one spinning on pop() from a mutex protected FixedLengthList.
+          Measures the latency from queueing an item to its being taken, and
+          the CPU time used by the consumer, for producers which are idle
+          (an item now and then), bursty (groups of items now and then) and
+          saturated (items as fast as they can be queued).  Build with e.g.
+
+       g++ -O2 -std=c++11 -pthread -I../src FixedLengthBlockingListBench.cpp
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+#include "FixedLengthBlockingList.hpp"
+
+#define LIST_LEN (256U)
+
+/** Largest batch taken by pop_wait_n() */
+#define BATCH_MAX (64U)
+
+/** Number of items queued between pauses, items between pauses and pause
+    length for each kind of producer */
+#define IDLE_ITEMS (200U)
+#define BURST_LEN (32U)
+#define BURSTS (200U)
+#define SATURATED_ITEMS (1000000U)
+#define PAUSE_US (1000U)
+
+/** CPU time used by the calling thread, in nanoseconds */
+static uint64_t thread_cpu_ns( void )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_THREAD_CPUTIME_ID, &ts );
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/** The arrangement being replaced - a list with a mutex around each
+    operation, the consumer spinning until an item appears */
+class SpinQueue
+{
+    private:
+        std::mutex m_lock;
+        FixedLengthList< uint64_t, LIST_LEN > m_list;
+    public:
+        void put( const uint64_t p_item ) {
+            for( ;; ) {
+                {
+                    std::lock_guard< std::mutex > guard( m_lock );
+                    if( m_list.queue( p_item ) ) {
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+        size_t take( uint64_t* const p_items ) {
+            for( ;; ) {
+                {
+                    std::lock_guard< std::mutex > guard( m_lock );
+                    if( m_list.pop( p_items ) ) {
+                        return 1U;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+};
+
+/** Consumer sleeping in pop_wait(), one item per wake up */
+class WaitQueue
+{
+    private:
+        FixedLengthBlockingList< uint64_t, LIST_LEN > m_list;
+    public:
+        void put( const uint64_t p_item ) {
+            m_list.queue_wait( p_item );
+        }
+        size_t take( uint64_t* const p_items ) {
+            m_list.pop_wait( p_items );
+            return 1U;
+        }
+};
+
+/** Consumer sleeping in pop_wait_n(), taking whatever has arrived */
+class BatchQueue
+{
+    private:
+        FixedLengthBlockingList< uint64_t, LIST_LEN > m_list;
+    public:
+        void put( const uint64_t p_item ) {
+            m_list.queue_wait( p_item );
+        }
+        size_t take( uint64_t* const p_items ) {
+            return m_list.pop_wait_n( p_items, BATCH_MAX );
+        }
+};
+
+/** Producer pattern - p_burst items queued back to back, p_groups times,
+    pausing between groups in the case that p_pause is set */
+struct Pattern
+{
+    const char* m_name;
+    unsigned    m_burst;
+    unsigned    m_groups;
+    bool        m_pause;
+};
+
+template < class Queue >
+static void run( Queue& p_queue, const char* p_consumer, const Pattern& p_pattern )
+{
+    const uint64_t total = (uint64_t)p_pattern.m_burst * p_pattern.m_groups;
+    uint64_t latency_sum = 0U;
+    uint64_t latency_max = 0U;
+    uint64_t cpu_ns = 0U;
+    uint64_t wakes = 0U;
+
+    uint64_t start = bench_now_ns();
+
+    std::thread consumer( [&]() {
+        uint64_t items[ BATCH_MAX ] = { 0 };
+        uint64_t cpu_start = thread_cpu_ns();
+        for( uint64_t got = 0U; got < total; ) {
+            size_t count = p_queue.take( items );
+            uint64_t now = bench_now_ns();
+            for( size_t k = 0; k < count; k++ ) {
+                uint64_t latency = now - items[ k ];
+                latency_sum += latency;
+                latency_max = ( latency > latency_max ) ? latency : latency_max;
+            }
+            got += count;
+            wakes++;
+        }
+        cpu_ns = thread_cpu_ns() - cpu_start;
+    } );
+
+    for( unsigned g = 0; g < p_pattern.m_groups; g++ ) {
+        if( p_pattern.m_pause ) {
+            std::this_thread::sleep_for( std::chrono::microseconds( PAUSE_US ) );
+        }
+        for( unsigned i = 0; i < p_pattern.m_burst; i++ ) {
+            p_queue.put( bench_now_ns() );
+        }
+    }
+
+    consumer.join();
+
+    uint64_t elapsed = bench_now_ns() - start;
+
+    printf( "%-10s %-12s %12.2f %12.2f %10.1f %12.2f %10.2f\n", p_pattern.m_name, p_consumer,
+            (double)latency_sum / (double)total / 1000.0, (double)latency_max / 1000.0,
+            (double)cpu_ns * 100.0 / (double)elapsed, (double)total * 1e3 / (double)elapsed,
+            (double)total / (double)wakes );
+}
+
+static SpinQueue spin;
+static WaitQueue waiting;
+static BatchQueue batch;
+
+int main( void )
+{
+    const Pattern patterns[] = {
+        { "idle",      1U,        IDLE_ITEMS, true  },
+        { "bursty",    BURST_LEN, BURSTS,     true  },
+        { "saturated", 1U,        SATURATED_ITEMS, false },
+    };
+
+    printf( "%-10s %-12s %12s %12s %10s %12s %10s\n", "producer", "consumer", "mean lat us", "max lat us",
+            "cons CPU%", "Mitems/s", "items/take" );
+
+    for( size_t p = 0; p < sizeof( patterns ) / sizeof( patterns[ 0 ] ); p++ ) {
+        run( spin, "spin pop", patterns[ p ] );
+        run( waiting, "pop_wait", patterns[ p ] );
+        run( batch, "pop_wait_n", patterns[ p ] );
+    }
+
+    return 0;
+}
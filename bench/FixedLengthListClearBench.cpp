@@ -0,0 +1,113 @@
+/**
+   @file
+   @brief Benchmark for FixedLengthList, comparing the cost of clear()ing the
+          list then using a few items across list capacities.  Build with
+          e.g.
+
+       g++ -O2 -std=c++11 -I../src FixedLengthListClearBench.cpp
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+
+/** Number of clear-then-use cycles for each measurement */
+#define CYCLES (1U << 16)
+
+/** Number of items used in each cycle */
+#define ITEMS_USED (8U)
+
+/** Reference for the previous behaviour of clear(), which threaded every
+    slot onto the free stack */
+template < size_t queueMax > struct EagerFreeStack
+{
+    FixedLengthListItem< int > m_items[ queueMax ];
+    FixedLengthListItem< int >* m_freeHead;
+
+    void clear( void )
+    {
+        m_freeHead = &( m_items[ 0 ] );
+        for( size_t i = 1; i < queueMax; i++ ) {
+            m_items[ i - 1U ].m_forward.set( &( m_items[ i ] ) );
+        }
+        m_items[ queueMax - 1U ].m_forward.set( NULL );
+    }
+};
+
+template < size_t queueMax >
+static void run( void )
+{
+    static FixedLengthList< int, queueMax > list;
+    static EagerFreeStack< queueMax > eager;
+    uint64_t sum = 0;
+    int v = 0;
+
+    /* Lazily initialised clear() */
+    uint64_t start = bench_now_ns();
+    for( unsigned c = 0; c < CYCLES; c++ )
+    {
+        list.clear();
+        for( unsigned i = 0; i < ITEMS_USED; i++ ) {
+            list.queue( (int)i );
+        }
+        while( list.pop( &v ) ) {
+            sum += v;
+        }
+    }
+    uint64_t lazy = bench_now_ns() - start;
+
+    /* The same, plus the cost of threading every slot as clear() used to */
+    start = bench_now_ns();
+    for( unsigned c = 0; c < CYCLES; c++ )
+    {
+        eager.clear();
+        sum += (uintptr_t)eager.m_items[ c % queueMax ].m_forward.get();
+        list.clear();
+        for( unsigned i = 0; i < ITEMS_USED; i++ ) {
+            list.queue( (int)i );
+        }
+        while( list.pop( &v ) ) {
+            sum += v;
+        }
+    }
+    uint64_t eager_ns = bench_now_ns() - start;
+
+    bench_sink = sum;
+
+    printf( "%10u %16.2f %16.2f\n", (unsigned)queueMax,
+            (double)lazy / CYCLES, (double)eager_ns / CYCLES );
+}
+
+int main( void )
+{
+    printf( "%10s %16s %16s\n", "queueMax", "lazy ns/cycle", "eager ns/cycle" );
+
+    run< 16 >();
+    run< 64 >();
+    run< 256 >();
+    run< 1024 >();
+    run< 4096 >();
+    run< 16384 >();
+
+    return 0;
+}
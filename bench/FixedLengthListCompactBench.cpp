@@ -0,0 +1,138 @@
+/**
+   @file
+   @brief Benchmark for FixedLengthList, comparing the speed of iterating
+          over a freshly filled list, the same list after heavy churn has
+          scattered its items through the storage, and the list once
+          compact() has laid them out in order again.  Build with e.g.
+
+       g++ -O2 -std=c++11 -I../src FixedLengthListCompactBench.cpp
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+
+/** Number of passes over the list for each measurement */
+#define PASSES (64U)
+
+/** Number of rounds of churn used to scatter the list */
+#define CHURN_ROUNDS (16U)
+
+/** Payload spanning a cache line, so that scattered items each cost a miss */
+struct Payload
+{
+    uint32_t m_key;
+    uint8_t  m_data[ 60 ];
+};
+
+/** Walk the whole list PASSES times, returning ns per item visited */
+template < class List >
+static double time_iteration( List& p_list )
+{
+    uint64_t sum = 0;
+    uint64_t start = bench_now_ns();
+
+    for( unsigned p = 0; p < PASSES; p++ )
+    {
+        for( typename List::const_iterator it = p_list.cbegin(); it != p_list.cend(); ++it ) {
+            sum += it->m_key;
+        }
+    }
+
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_sink = sum;
+
+    return (double)elapsed / ( (double)PASSES * (double)p_list.used() );
+}
+
+template < size_t queueMax, template < class, size_t > class Links >
+static void run( const char* p_links )
+{
+    static FixedLengthList< Payload, queueMax, Links > list;
+    Payload item = Payload();
+    uint32_t seed = 1U;
+
+    list.clear();
+
+    for( uint32_t i = 0; i < queueMax; i++ )
+    {
+        item.m_key = i;
+        list.queue( item );
+    }
+    double fresh = time_iteration( list );
+
+    /* Each round erases a quarter of the items at random, then replaces
+       them at random ends, so that slots freed in the middle of the list
+       are reused at either end */
+    for( uint32_t r = 0; r < CHURN_ROUNDS; r++ )
+    {
+        size_t erased = 0U;
+
+        for( typename FixedLengthList< Payload, queueMax, Links >::iterator it = list.begin(); it != list.end(); )
+        {
+            seed = seed * 1103515245U + 12345U;
+            if( ( ( seed >> 16 ) & 3U ) == 0U ) {
+                it = list.erase( it );
+                erased++;
+            } else {
+                ++it;
+            }
+        }
+
+        for( ; erased > 0U; erased-- )
+        {
+            seed = seed * 1103515245U + 12345U;
+            item.m_key = seed;
+            if( ( seed >> 16 ) & 1U ) {
+                list.push( item );
+            } else {
+                list.queue( item );
+            }
+        }
+    }
+    double churned = time_iteration( list );
+
+    uint64_t start = bench_now_ns();
+    size_t moved = list.compact();
+    uint64_t compact_ns = bench_now_ns() - start;
+
+    double compacted = time_iteration( list );
+
+    printf( "%-14s %10u %8u %12.2f %12.2f %12.2f %8u %12.1f\n", p_links, (unsigned)queueMax, (unsigned)list.used(),
+            fresh, churned, compacted, (unsigned)moved, (double)compact_ns / 1000.0 );
+}
+
+int main( void )
+{
+    printf( "%-14s %10s %8s %12s %12s %12s %8s %12s\n", "links", "queueMax", "used",
+            "fresh ns", "churned ns", "compact ns", "moved", "compact() us" );
+
+    run< 1024, FixedLengthListDoubleLinks >( "double" );
+    run< 16384, FixedLengthListDoubleLinks >( "double" );
+    run< 262144, FixedLengthListDoubleLinks >( "double" );
+    run< 1024, FixedLengthListCompactDoubleLinks >( "compact double" );
+    run< 16384, FixedLengthListCompactDoubleLinks >( "compact double" );
+    run< 262144, FixedLengthListCompactDoubleLinks >( "compact double" );
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/**
+   @file
+   @brief Benchmark of FixedLengthList::dequeue() against list capacity
+
+   Fills lists of increasing capacity and measures the average cost of
+   draining them from the back with dequeue().  With the default singly linked
+   policy each dequeue() walks the list, so the cost grows with queueMax; with
+   FixedLengthListDoubleLinks it should remain flat.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+
+/** Total number of dequeue() calls to make for each measurement */
+#define DEQUEUE_OPS (1U << 20)
+
+template < size_t queueMax, template < class, size_t > class Links >
+static double dequeue_ns( void )
+{
+    static FixedLengthList< int, queueMax, Links > list;
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    unsigned rounds = DEQUEUE_OPS / queueMax;
+
+    /* The singly linked list is O(n^2) to drain, so cap the work done at the
+       larger capacities */
+    if( rounds == 0 ) {
+        rounds = 1;
+    }
+
+    for( unsigned r = 0; r < rounds; r++ )
+    {
+        int v;
+
+        for( size_t i = 0; i < queueMax; i++ ) {
+            list.queue( (int)i );
+        }
+
+        uint64_t start = bench_now_ns();
+        while( list.dequeue( &v ) ) {
+            sum += v;
+        }
+        total += bench_now_ns() - start;
+    }
+
+    bench_sink = sum;
+
+    return (double)total / ( (double)rounds * queueMax );
+}
+
+template < size_t queueMax >
+static void run( void )
+{
+    printf( "%10u %14.2f %14.2f\n", (unsigned)queueMax,
+            dequeue_ns< queueMax, FixedLengthListSingleLinks >(),
+            dequeue_ns< queueMax, FixedLengthListDoubleLinks >() );
+}
+
+int main( void )
+{
+    printf( "%10s %14s %14s\n", "queueMax", "single ns/op", "double ns/op" );
+
+    run< 16 >();
+    run< 64 >();
+    run< 256 >();
+    run< 1024 >();
+    run< 4096 >();
+    run< 16384 >();
+
+    return 0;
+}
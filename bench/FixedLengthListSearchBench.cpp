@@ -0,0 +1,98 @@
+/**
+   @file
+   @brief Benchmark for FixedLengthList, comparing the cost of inList() for
+          an item which is not in a full list: walking the list, scanning
+          the pool with FixedLengthListScanIndex and looking the item up with
+          FixedLengthListHashIndex.  Build with e.g.
+
+       g++ -O2 -std=c++11 -I../src FixedLengthListSearchBench.cpp
+
+   adding -mavx2 to use AVX2 rather than SSE2 for the scan.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+#include "FixedLengthListScanIndex.hpp"
+
+/** Number of items visited across all the lookups for each measurement,
+    keeping the run time roughly constant across capacities */
+#define SEARCH_WORK (1UL << 26)
+
+struct IntHash
+{
+    size_t operator()( const int p_val ) const { return (size_t)p_val * 2654435761U; }
+};
+
+template < size_t queueMax, class Index >
+static double search_ns( void )
+{
+    static FixedLengthList< int, queueMax, FixedLengthListCompactDoubleLinks, Index > list;
+    unsigned long lookups = SEARCH_WORK / queueMax;
+    uint64_t found = 0;
+
+    if( lookups < 16U ) {
+        lookups = 16U;
+    }
+
+    for( size_t i = 0; i < queueMax; i++ ) {
+        list.queue( (int)( i * 2U ) );
+    }
+
+    uint64_t start = bench_now_ns();
+    for( unsigned long l = 0; l < lookups; l++ ) {
+        /* Odd values are never in the list */
+        found += list.inList( (int)( l * 2U + 1U ) );
+    }
+    uint64_t total = bench_now_ns() - start;
+
+    bench_sink = found;
+    list.clear();
+
+    return (double)total / (double)lookups;
+}
+
+template < size_t queueMax >
+static void run( void )
+{
+    printf( "%10u %14.1f %14.1f %14.1f\n", (unsigned)queueMax,
+            search_ns< queueMax, FixedLengthListNoIndex >(),
+            search_ns< queueMax, FixedLengthListScanIndex >(),
+            search_ns< queueMax, FixedLengthListHashIndex< IntHash > >() );
+}
+
+int main( void )
+{
+    printf( "%10s %14s %14s %14s\n", "queueMax", "walk ns/op", "scan ns/op", "hash ns/op" );
+
+    run< 64 >();
+    run< 256 >();
+    run< 1024 >();
+    run< 4096 >();
+    run< 16384 >();
+    run< 65536 >();
+    run< 262144 >();
+    run< 1048576 >();
+
+    return 0;
+}
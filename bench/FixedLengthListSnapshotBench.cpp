@@ -0,0 +1,198 @@
+/**
+   @file
+   @brief Benchmark for FixedLengthList::snapshot() and restore(), comparing
+          checkpointing a list of 1M items by walking it and copying each
+          item out, then clear()ing the list and queue()ing each item back,
+          with the bulk copy and in-order relink of snapshot() & restore().
+          Lists are measured both freshly filled and after churn has
+          scattered their items through the storage.  Build with e.g.
+
+       g++ -O2 -std=c++11 -I../src FixedLengthListSnapshotBench.cpp
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+
+/** Number of items in each list */
+#define ITEM_COUNT ( 1U << 20 )
+
+/** Number of checkpoints taken for each measurement */
+#define PASSES (8U)
+
+/** Number of rounds of churn used to scatter the list */
+#define CHURN_ROUNDS (4U)
+
+/** Typical small record */
+struct Payload
+{
+    uint32_t m_key;
+    uint8_t  m_data[ 28 ];
+};
+
+/** Fill p_list, then optionally churn it so that the items are scattered */
+template < class List >
+static void fill( List& p_list, const bool p_churn )
+{
+    Payload item = Payload();
+    uint32_t seed = 1U;
+
+    p_list.clear();
+
+    for( uint32_t i = 0; i < ITEM_COUNT; i++ )
+    {
+        item.m_key = i;
+        p_list.queue( item );
+    }
+
+    for( uint32_t r = 0; p_churn && ( r < CHURN_ROUNDS ); r++ )
+    {
+        size_t erased = 0U;
+
+        for( typename List::iterator it = p_list.begin(); it != p_list.end(); )
+        {
+            seed = seed * 1103515245U + 12345U;
+            if( ( ( seed >> 16 ) & 3U ) == 0U ) {
+                it = p_list.erase( it );
+                erased++;
+            } else {
+                ++it;
+            }
+        }
+
+        for( ; erased > 0U; erased-- )
+        {
+            seed = seed * 1103515245U + 12345U;
+            item.m_key = seed;
+            if( ( seed >> 16 ) & 1U ) {
+                p_list.push( item );
+            } else {
+                p_list.queue( item );
+            }
+        }
+    }
+}
+
+/** Checkpoint by copying each item out, and restore by queue()ing each
+    item back.  Returns ns per item for save and restore */
+template < class List >
+static void time_naive( List& p_list, unsigned char* const p_buffer, double* const p_save, double* const p_restore )
+{
+    uint64_t save_ns = 0U;
+    uint64_t restore_ns = 0U;
+    size_t count = p_list.used();
+
+    for( unsigned p = 0; p < PASSES; p++ )
+    {
+        uint64_t start = bench_now_ns();
+        unsigned char* out = p_buffer;
+        for( typename List::const_iterator it = p_list.cbegin(); it != p_list.cend(); ++it ) {
+            memcpy( out, &( *it ), sizeof( Payload ) );
+            out += sizeof( Payload );
+        }
+        save_ns += bench_now_ns() - start;
+
+        start = bench_now_ns();
+        const unsigned char* in = p_buffer;
+        Payload item;
+        p_list.clear();
+        for( size_t i = 0; i < count; i++ ) {
+            memcpy( &item, in, sizeof( Payload ) );
+            in += sizeof( Payload );
+            p_list.queue( item );
+        }
+        restore_ns += bench_now_ns() - start;
+    }
+
+    bench_sink = p_list.used();
+    *p_save = (double)save_ns / ( (double)PASSES * (double)count );
+    *p_restore = (double)restore_ns / ( (double)PASSES * (double)count );
+}
+
+/** Checkpoint with snapshot() & restore().  Returns ns per item for save
+    and restore */
+template < class List >
+static void time_snapshot( List& p_list, unsigned char* const p_buffer, const size_t p_size, double* const p_save, double* const p_restore )
+{
+    uint64_t save_ns = 0U;
+    uint64_t restore_ns = 0U;
+    size_t count = p_list.used();
+    size_t bytes = 0U;
+
+    for( unsigned p = 0; p < PASSES; p++ )
+    {
+        uint64_t start = bench_now_ns();
+        bytes += p_list.snapshot( p_buffer, p_size );
+        save_ns += bench_now_ns() - start;
+
+        start = bench_now_ns();
+        bytes += p_list.restore( p_buffer, p_size );
+        restore_ns += bench_now_ns() - start;
+    }
+
+    bench_sink = bytes;
+    *p_save = (double)save_ns / ( (double)PASSES * (double)count );
+    *p_restore = (double)restore_ns / ( (double)PASSES * (double)count );
+}
+
+template < template < class, size_t > class Links >
+static void run( const char* p_links, std::vector< unsigned char >& p_buffer )
+{
+    static FixedLengthList< Payload, ITEM_COUNT, Links > list;
+    const char* const states[] = { "fresh", "churned" };
+
+    for( unsigned s = 0; s < 2U; s++ )
+    {
+        double naive_save, naive_restore, snap_save, snap_restore;
+
+        fill( list, s != 0U );
+        time_naive( list, &p_buffer[ 0 ], &naive_save, &naive_restore );
+
+        /* The naive restore re-queued the items in order, so scatter them
+           again before measuring snapshot() */
+        fill( list, s != 0U );
+        time_snapshot( list, &p_buffer[ 0 ], p_buffer.size(), &snap_save, &snap_restore );
+
+        printf( "%-14s %-8s %10.2f %10.2f %10.2f %10.2f %10.2f\n", p_links, states[ s ],
+                naive_save, naive_restore, snap_save, snap_restore,
+                (double)sizeof( Payload ) / snap_save );
+    }
+}
+
+int main( void )
+{
+    std::vector< unsigned char > buffer( sizeof( FixedLengthListSnapshotHeader ) + ( ITEM_COUNT * sizeof( Payload ) ) );
+
+    printf( "%u items of %u bytes, ns per item\n", (unsigned)ITEM_COUNT, (unsigned)sizeof( Payload ) );
+    printf( "%-14s %-8s %10s %10s %10s %10s %10s\n", "links", "list", "copy out", "queue in",
+            "snapshot", "restore", "snap GB/s" );
+
+    run< FixedLengthListSingleLinks >( "single", buffer );
+    run< FixedLengthListDoubleLinks >( "double", buffer );
+    run< FixedLengthListCompactSingleLinks >( "compact single", buffer );
+    run< FixedLengthListCompactDoubleLinks >( "compact double", buffer );
+
+    return 0;
+}
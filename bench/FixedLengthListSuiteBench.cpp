@@ -0,0 +1,421 @@
+/**
+   @file
+   @brief Benchmark suite comparing FixedLengthList with std::list,
+          std::deque and std::vector across operations, payload sizes and
+          capacities.  Results are written as CSV (the default) or JSON, one
+          record per measurement, for tracking between releases.  Build
+          with the Makefile in this directory, or e.g.
+
+       g++ -O2 -std=c++11 -I../src FixedLengthListSuiteBench.cpp
+
+   Usage:
+
+       FixedLengthListSuiteBench [--json] [--quick]
+
+   --quick runs fewer repetitions, for a fast sanity check.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <new>
+#include <vector>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+
+/** Approximate number of items handled by each measurement, spread over
+    as many fills of the container as needed */
+static unsigned s_items_per_measurement = 1U << 20;
+
+/** Write JSON rather than CSV */
+static bool s_json = false;
+
+/** Number of records written so far, for separating JSON records */
+static unsigned s_records = 0;
+
+/**
+   Item stored in the containers.  Only the key takes part in comparisons,
+   the rest pads the item out to the size being measured, so that the cost
+   of copying it is included
+*/
+template < size_t bytes > struct Payload
+{
+    uint32_t m_key;
+    unsigned char m_pad[ bytes - sizeof( uint32_t ) ];
+
+    Payload( const uint32_t p_key = 0 ) : m_key( p_key ) { memset( m_pad, 0, sizeof( m_pad ) ); }
+    bool operator==( const Payload& p_other ) const { return m_key == p_other.m_key; }
+};
+
+template <> struct Payload< sizeof( uint32_t ) >
+{
+    uint32_t m_key;
+
+    Payload( const uint32_t p_key = 0 ) : m_key( p_key ) {}
+    bool operator==( const Payload& p_other ) const { return m_key == p_other.m_key; }
+};
+
+/*
+    Adapters giving each container the same interface.  has_front is set
+    where taking items from the front is supported efficiently, and
+    has_back where removing them from the back is
+*/
+
+template < class T, size_t capacity, template < class, size_t > class Links > struct FllAdapter
+{
+    enum { has_front = 1, has_back = Links< T, capacity >::doubly_linked };
+
+    typedef FixedLengthList< T, capacity, Links > container_t;
+    container_t m_c;
+
+    void push( const T& p_v ) { m_c.push( p_v ); }
+    void queue( const T& p_v ) { m_c.queue( p_v ); }
+    uint32_t pop( void ) { T v; m_c.pop( &v ); return v.m_key; }
+    uint32_t dequeue( void ) { T v; m_c.dequeue( &v ); return v.m_key; }
+    bool remove( const T& p_v ) { return m_c.remove( p_v ); }
+    bool contains( const T& p_v ) { return m_c.inList( p_v ); }
+    void clear( void ) { m_c.clear(); }
+    uint64_t sum( void )
+    {
+        uint64_t ret_val = 0;
+        for( typename container_t::iterator it = m_c.begin(); it != m_c.end(); ++it ) {
+            ret_val += (*it).m_key;
+        }
+        return ret_val;
+    }
+};
+
+template < class T, size_t capacity > struct FllSingle : public FllAdapter< T, capacity, FixedLengthListSingleLinks >
+{
+    static const char* name( void ) { return "FixedLengthList<single>"; }
+};
+
+template < class T, size_t capacity > struct FllDouble : public FllAdapter< T, capacity, FixedLengthListDoubleLinks >
+{
+    static const char* name( void ) { return "FixedLengthList<double>"; }
+};
+
+template < class T, size_t capacity > struct FllCompactDouble : public FllAdapter< T, capacity, FixedLengthListCompactDoubleLinks >
+{
+    static const char* name( void ) { return "FixedLengthList<compact double>"; }
+};
+
+/** Shared by the std containers which support push_front() */
+template < class C > struct StdFrontAdapter
+{
+    enum { has_front = 1, has_back = 1 };
+
+    typedef typename C::value_type T;
+    C m_c;
+
+    void push( const T& p_v ) { m_c.push_front( p_v ); }
+    void queue( const T& p_v ) { m_c.push_back( p_v ); }
+    uint32_t pop( void ) { uint32_t k = m_c.front().m_key; m_c.pop_front(); return k; }
+    uint32_t dequeue( void ) { uint32_t k = m_c.back().m_key; m_c.pop_back(); return k; }
+    bool remove( const T& p_v )
+    {
+        typename C::iterator it = std::find( m_c.begin(), m_c.end(), p_v );
+        bool ret_val = ( it != m_c.end() );
+        if( ret_val ) {
+            m_c.erase( it );
+        }
+        return ret_val;
+    }
+    bool contains( const T& p_v ) { return std::find( m_c.begin(), m_c.end(), p_v ) != m_c.end(); }
+    void clear( void ) { m_c.clear(); }
+    uint64_t sum( void )
+    {
+        uint64_t ret_val = 0;
+        for( typename C::const_iterator it = m_c.begin(); it != m_c.end(); ++it ) {
+            ret_val += it->m_key;
+        }
+        return ret_val;
+    }
+};
+
+template < class T, size_t capacity > struct StdList : public StdFrontAdapter< std::list< T > >
+{
+    static const char* name( void ) { return "std::list"; }
+};
+
+template < class T, size_t capacity > struct StdDeque : public StdFrontAdapter< std::deque< T > >
+{
+    static const char* name( void ) { return "std::deque"; }
+};
+
+/** std::vector has no push_front(), so push/pop are at the back (which is
+    the same LIFO behaviour) and there is no efficient FIFO.  Capacity is
+    reserved up front, as it would be when replacing a fixed length list */
+template < class T, size_t capacity > struct StdVector
+{
+    enum { has_front = 0, has_back = 1 };
+
+    std::vector< T > m_c;
+
+    static const char* name( void ) { return "std::vector"; }
+
+    StdVector( void ) { m_c.reserve( capacity ); }
+    void push( const T& p_v ) { m_c.push_back( p_v ); }
+    void queue( const T& p_v ) { m_c.push_back( p_v ); }
+    uint32_t pop( void ) { uint32_t k = m_c.back().m_key; m_c.pop_back(); return k; }
+    uint32_t dequeue( void ) { return pop(); }
+    bool remove( const T& p_v )
+    {
+        typename std::vector< T >::iterator it = std::find( m_c.begin(), m_c.end(), p_v );
+        bool ret_val = ( it != m_c.end() );
+        if( ret_val ) {
+            m_c.erase( it );
+        }
+        return ret_val;
+    }
+    bool contains( const T& p_v ) { return std::find( m_c.begin(), m_c.end(), p_v ) != m_c.end(); }
+    void clear( void ) { m_c.clear(); }
+    uint64_t sum( void )
+    {
+        uint64_t ret_val = 0;
+        for( size_t i = 0; i < m_c.size(); i++ ) {
+            ret_val += m_c[ i ].m_key;
+        }
+        return ret_val;
+    }
+};
+
+/** Write one measurement */
+static void report( const char* p_container, const char* p_op, const size_t p_payload, const size_t p_capacity, const double p_ns )
+{
+    if( s_json )
+    {
+        printf( "%s\n  { \"container\": \"%s\", \"op\": \"%s\", \"payload_bytes\": %u, \"capacity\": %u, \"ns_per_item\": %.3f }",
+                ( s_records == 0 ) ? "[" : ",", p_container, p_op, (unsigned)p_payload, (unsigned)p_capacity, p_ns );
+    }
+    else
+    {
+        if( s_records == 0 ) {
+            printf( "container,op,payload_bytes,capacity,ns_per_item\n" );
+        }
+        printf( "\"%s\",%s,%u,%u,%.3f\n", p_container, p_op, (unsigned)p_payload, (unsigned)p_capacity, p_ns );
+    }
+    s_records++;
+}
+
+/** Keys in a pseudo-random order, so that searches and removals don't
+    always hit the same end of the container */
+static void shuffled_keys( uint32_t* const p_keys, const size_t p_count )
+{
+    uint32_t seed = 12345U;
+
+    for( size_t i = 0; i < p_count; i++ ) {
+        p_keys[ i ] = (uint32_t)i;
+    }
+    for( size_t i = p_count - 1U; i > 0; i-- )
+    {
+        seed = seed * 1103515245U + 12345U;
+        std::swap( p_keys[ i ], p_keys[ ( seed >> 8 ) % ( i + 1U ) ] );
+    }
+}
+
+/** Run every operation against one container, payload and capacity */
+template < template < class, size_t > class Adapter, size_t bytes, size_t capacity >
+static void run_container( void )
+{
+    typedef Payload< bytes > T;
+    typedef Adapter< T, capacity > adapter_t;
+
+    /* Containers may be large, so are kept off the stack */
+    adapter_t* a = new adapter_t();
+    std::vector< uint32_t > keys( capacity );
+    unsigned rounds = s_items_per_measurement / capacity;
+    /* Searching and removal are quadratic, so are given less work */
+    unsigned search_rounds = ( s_items_per_measurement / 256U ) / capacity;
+    uint64_t sum = 0;
+    uint64_t t;
+    uint64_t total;
+
+    if( rounds == 0 ) {
+        rounds = 1;
+    }
+    if( search_rounds == 0 ) {
+        search_rounds = 1;
+    }
+
+    shuffled_keys( &( keys[ 0 ] ), capacity );
+
+    /* push then pop, from the front (LIFO) */
+    t = bench_now_ns();
+    for( unsigned r = 0; r < rounds; r++ )
+    {
+        for( size_t i = 0; i < capacity; i++ ) {
+            a->push( T( (uint32_t)i ) );
+        }
+        for( size_t i = 0; i < capacity; i++ ) {
+            sum += a->pop();
+        }
+    }
+    report( adapter_t::name(), "push_pop", bytes, capacity, (double)( bench_now_ns() - t ) / ( 2.0 * rounds * capacity ) );
+
+    /* queue then pop (FIFO) */
+    if( adapter_t::has_front )
+    {
+        t = bench_now_ns();
+        for( unsigned r = 0; r < rounds; r++ )
+        {
+            for( size_t i = 0; i < capacity; i++ ) {
+                a->queue( T( (uint32_t)i ) );
+            }
+            for( size_t i = 0; i < capacity; i++ ) {
+                sum += a->pop();
+            }
+        }
+        report( adapter_t::name(), "queue_pop", bytes, capacity, (double)( bench_now_ns() - t ) / ( 2.0 * rounds * capacity ) );
+    }
+
+    /* queue then dequeue, at the back */
+    if( adapter_t::has_back )
+    {
+        t = bench_now_ns();
+        for( unsigned r = 0; r < rounds; r++ )
+        {
+            for( size_t i = 0; i < capacity; i++ ) {
+                a->queue( T( (uint32_t)i ) );
+            }
+            for( size_t i = 0; i < capacity; i++ ) {
+                sum += a->dequeue();
+            }
+        }
+        report( adapter_t::name(), "queue_dequeue", bytes, capacity, (double)( bench_now_ns() - t ) / ( 2.0 * rounds * capacity ) );
+    }
+
+    /* Iterate over a full container */
+    for( size_t i = 0; i < capacity; i++ ) {
+        a->queue( T( (uint32_t)i ) );
+    }
+    t = bench_now_ns();
+    for( unsigned r = 0; r < rounds; r++ ) {
+        sum += a->sum();
+    }
+    report( adapter_t::name(), "iterate", bytes, capacity, (double)( bench_now_ns() - t ) / ( (double)rounds * capacity ) );
+
+    /* Search a full container for every item, in random order */
+    t = bench_now_ns();
+    for( unsigned r = 0; r < search_rounds; r++ )
+    {
+        for( size_t i = 0; i < capacity; i++ ) {
+            sum += a->contains( T( keys[ i ] ) );
+        }
+    }
+    report( adapter_t::name(), "inList", bytes, capacity, (double)( bench_now_ns() - t ) / ( (double)search_rounds * capacity ) );
+
+    /* Remove every item, in random order.  Refilling isn't timed */
+    total = 0;
+    for( unsigned r = 0; r < search_rounds; r++ )
+    {
+        if( r > 0 )
+        {
+            for( size_t i = 0; i < capacity; i++ ) {
+                a->queue( T( (uint32_t)i ) );
+            }
+        }
+        t = bench_now_ns();
+        for( size_t i = 0; i < capacity; i++ ) {
+            sum += a->remove( T( keys[ i ] ) );
+        }
+        total += bench_now_ns() - t;
+    }
+    report( adapter_t::name(), "remove", bytes, capacity, (double)total / ( (double)search_rounds * capacity ) );
+
+    /* clear() a full container.  Refilling isn't timed */
+    total = 0;
+    for( unsigned r = 0; r < rounds; r++ )
+    {
+        for( size_t i = 0; i < capacity; i++ ) {
+            a->queue( T( (uint32_t)i ) );
+        }
+        t = bench_now_ns();
+        a->clear();
+        total += bench_now_ns() - t;
+    }
+    report( adapter_t::name(), "clear", bytes, capacity, (double)total / ( (double)rounds * capacity ) );
+
+    delete a;
+
+    /* Construct and destroy an empty container, in place.  Reported per
+       construction rather than per item */
+    void* buf = ::operator new( sizeof( adapter_t ) );
+    t = bench_now_ns();
+    for( unsigned r = 0; r < rounds; r++ )
+    {
+        adapter_t* c = ::new( buf ) adapter_t();
+        sum += (uintptr_t)c;
+        c->~adapter_t();
+    }
+    report( adapter_t::name(), "construct", bytes, capacity, (double)( bench_now_ns() - t ) / rounds );
+    ::operator delete( buf );
+
+    bench_sink = sum;
+}
+
+template < size_t bytes, size_t capacity >
+static void run_all( void )
+{
+    run_container< FllSingle, bytes, capacity >();
+    run_container< FllDouble, bytes, capacity >();
+    run_container< FllCompactDouble, bytes, capacity >();
+    run_container< StdList, bytes, capacity >();
+    run_container< StdDeque, bytes, capacity >();
+    run_container< StdVector, bytes, capacity >();
+}
+
+template < size_t bytes >
+static void run_payload( void )
+{
+    run_all< bytes, 16 >();
+    run_all< bytes, 256 >();
+    run_all< bytes, 4096 >();
+}
+
+int main( int argc, char* argv[] )
+{
+    for( int i = 1; i < argc; i++ )
+    {
+        if( strcmp( argv[ i ], "--json" ) == 0 ) {
+            s_json = true;
+        } else if( strcmp( argv[ i ], "--quick" ) == 0 ) {
+            s_items_per_measurement = 1U << 14;
+        } else {
+            fprintf( stderr, "Usage: %s [--json] [--quick]\n", argv[ 0 ] );
+            return 1;
+        }
+    }
+
+    run_payload< 4 >();
+    run_payload< 64 >();
+    run_payload< 256 >();
+
+    if( s_json ) {
+        printf( "\n]\n" );
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+   @file
+   @brief Benchmark of FixedLengthMPMCList throughput against thread count,
+          compared with a mutex protected FixedLengthList
+
+   Each thread repeatedly queue()s an item and pop()s one, so every thread is
+   both a producer and a consumer.  The thread count runs from 1 to the
+   number of hardware threads.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+#include "FixedLengthMPMCList.hpp"
+
+/** Number of queue()/pop() pairs made by each thread */
+#define PAIRS_PER_THREAD (1U << 20)
+
+#define LIST_LEN (1024U)
+
+/** The arrangement being replaced - a list with a mutex around each
+    operation */
+class LockedList
+{
+    private:
+        std::mutex m_lock;
+        FixedLengthList< unsigned, LIST_LEN > m_list;
+    public:
+        bool queue( const unsigned p_item ) {
+            std::lock_guard< std::mutex > guard( m_lock );
+            return m_list.queue( p_item );
+        }
+        bool pop( unsigned* const p_item ) {
+            std::lock_guard< std::mutex > guard( m_lock );
+            return m_list.pop( p_item );
+        }
+};
+
+template < class Q >
+static double mops_per_sec( Q& p_q, const unsigned p_threads )
+{
+    std::vector< std::thread > threads;
+
+    uint64_t start = bench_now_ns();
+
+    for( unsigned t = 0; t < p_threads; t++ ) {
+        threads.push_back( std::thread( [&p_q]() {
+            uint64_t sum = 0;
+            for( unsigned n = 0; n < PAIRS_PER_THREAD; n++ ) {
+                unsigned v;
+                while( !p_q.queue( n ) ) {
+                    std::this_thread::yield();
+                }
+                while( !p_q.pop( &v ) ) {
+                    std::this_thread::yield();
+                }
+                sum += v;
+            }
+            bench_sink = sum;
+        } ) );
+    }
+
+    for( unsigned t = 0; t < p_threads; t++ ) {
+        threads[ t ].join();
+    }
+
+    uint64_t elapsed = bench_now_ns() - start;
+
+    return 2.0 * PAIRS_PER_THREAD * p_threads * 1e3 / (double)elapsed;
+}
+
+static LockedList locked;
+static FixedLengthMPMCList< unsigned, LIST_LEN > mpmc;
+
+int main( void )
+{
+    unsigned max_threads = std::thread::hardware_concurrency();
+
+    if( max_threads == 0 ) {
+        max_threads = 1;
+    }
+
+    printf( "%8s %18s %18s\n", "threads", "list+mutex Mops/s", "MPMC list Mops/s" );
+
+    for( unsigned t = 1; t <= max_threads; t = ( t < max_threads && t * 2 > max_threads ) ? max_threads : t * 2 ) {
+        printf( "%8u %18.2f %18.2f\n", t, mops_per_sec( locked, t ), mops_per_sec( mpmc, t ) );
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+   @file
+   @brief Benchmark comparing FixedLengthRing with FixedLengthList on FIFO
+          and deque workloads
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+#include "FixedLengthRing.hpp"
+
+/** Number of operations to make for each measurement */
+#define OPS (1U << 22)
+
+/** FIFO: keep the container half full, queue()ing at the back and pop()ing
+    from the front */
+template < class C, size_t queueMax >
+static double fifo_ns( C& p_c )
+{
+    uint64_t sum = 0;
+    int v = 0;
+
+    p_c.clear();
+    for( size_t i = 0; i < queueMax / 2; i++ ) {
+        p_c.queue( (int)i );
+    }
+
+    uint64_t start = bench_now_ns();
+    for( unsigned i = 0; i < OPS; i++ ) {
+        p_c.queue( (int)i );
+        p_c.pop( &v );
+        sum += v;
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink = sum;
+    return (double)elapsed / OPS;
+}
+
+/** Deque: bursts of push()/queue() followed by bursts of pop()/dequeue(),
+    using both ends of the container */
+template < class C, size_t queueMax >
+static double deque_ns( C& p_c )
+{
+    uint64_t sum = 0;
+    int v = 0;
+    unsigned ops = 0;
+
+    p_c.clear();
+
+    uint64_t start = bench_now_ns();
+    while( ops < OPS ) {
+        for( size_t i = 0; i < queueMax / 2; i++ ) {
+            p_c.push( (int)i );
+            p_c.queue( (int)i );
+        }
+        for( size_t i = 0; i < queueMax / 2; i++ ) {
+            p_c.dequeue( &v );
+            sum += v;
+            p_c.pop( &v );
+            sum += v;
+        }
+        ops += queueMax * 2;
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink = sum;
+    return (double)elapsed / ops;
+}
+
+template < size_t queueMax >
+static void run( void )
+{
+    static FixedLengthList< int, queueMax > slist;
+    static FixedLengthList< int, queueMax, FixedLengthListDoubleLinks > dlist;
+    static FixedLengthRing< int, queueMax > ring;
+
+    printf( "%10u %-6s %14.2f %14.2f %14.2f\n", (unsigned)queueMax, "fifo",
+            fifo_ns< FixedLengthList< int, queueMax >, queueMax >( slist ),
+            fifo_ns< FixedLengthList< int, queueMax, FixedLengthListDoubleLinks >, queueMax >( dlist ),
+            fifo_ns< FixedLengthRing< int, queueMax >, queueMax >( ring ) );
+
+    /* The singly linked list's O(n) dequeue() makes it impractical at larger
+       capacities */
+    char single_deque[ 16 ] = "n/a";
+    if( queueMax <= 1024 ) {
+        snprintf( single_deque, sizeof( single_deque ), "%.2f", deque_ns< FixedLengthList< int, queueMax >, queueMax >( slist ) );
+    }
+
+    printf( "%10u %-6s %14s %14.2f %14.2f\n", (unsigned)queueMax, "deque",
+            single_deque,
+            deque_ns< FixedLengthList< int, queueMax, FixedLengthListDoubleLinks >, queueMax >( dlist ),
+            deque_ns< FixedLengthRing< int, queueMax >, queueMax >( ring ) );
+}
+
+int main( void )
+{
+    printf( "%10s %-6s %14s %14s %14s\n", "queueMax", "load", "list ns/op", "dlist ns/op", "ring ns/op" );
+
+    run< 16 >();
+    run< 100 >();
+    run< 1024 >();
+    run< 65536 >();
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+   @file
+   @brief Benchmark of handoff throughput between two threads using
+          FixedLengthSPSCQueue, compared with a mutex protected
+          FixedLengthList
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <mutex>
+#include <thread>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+#include "FixedLengthSPSCQueue.hpp"
+
+/** Number of items to pass from producer to consumer */
+#define HANDOFFS (1U << 24)
+
+#define QUEUE_LEN (1024U)
+
+/** The arrangement being replaced - a list with a mutex around each
+    operation */
+class LockedList
+{
+    private:
+        std::mutex m_lock;
+        FixedLengthList< unsigned, QUEUE_LEN > m_list;
+    public:
+        bool queue( const unsigned p_item ) {
+            std::lock_guard< std::mutex > guard( m_lock );
+            return m_list.queue( p_item );
+        }
+        bool pop( unsigned* const p_item ) {
+            std::lock_guard< std::mutex > guard( m_lock );
+            return m_list.pop( p_item );
+        }
+};
+
+template < class Q >
+static double handoffs_per_sec( Q& p_q )
+{
+    uint64_t sum = 0;
+
+    uint64_t start = bench_now_ns();
+
+    std::thread producer( [&p_q]() {
+        for( unsigned n = 0; n < HANDOFFS; n++ ) {
+            while( !p_q.queue( n ) ) {
+                std::this_thread::yield();
+            }
+        }
+    } );
+
+    for( unsigned n = 0; n < HANDOFFS; n++ ) {
+        unsigned v;
+        while( !p_q.pop( &v ) ) {
+            std::this_thread::yield();
+        }
+        sum += v;
+    }
+
+    producer.join();
+
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink = sum;
+    return (double)HANDOFFS * 1e9 / (double)elapsed;
+}
+
+static LockedList locked;
+static FixedLengthSPSCQueue< unsigned, QUEUE_LEN > spsc;
+
+int main( void )
+{
+    printf( "%-24s %14s\n", "queue", "Mhandoffs/s" );
+    printf( "%-24s %14.2f\n", "FixedLengthList+mutex", handoffs_per_sec( locked ) / 1e6 );
+    printf( "%-24s %14.2f\n", "FixedLengthSPSCQueue", handoffs_per_sec( spsc ) / 1e6 );
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+/**
+   @file
+   @brief Benchmark of a small work-stealing thread pool built on
+          FixedLengthWorkStealingDeque, against thread count, compared with
+          a pool sharing one mutex protected FixedLengthList
+
+   The work is a binary tree of tasks: running a task spawns its two
+   children until the leaves are reached.  Only the first worker is given
+   the root, so every other worker depends on stealing (or on the shared
+   list) to find anything to do.  The thread count runs from 1 to the
+   number of hardware threads.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+#include "FixedLengthList.hpp"
+#include "FixedLengthWorkStealingDeque.hpp"
+
+/** Depth of the task tree - there are 2^(TREE_DEPTH+1)-1 tasks */
+#define TREE_DEPTH (20U)
+
+/** Iterations of busy work done by each task */
+#define TASK_WORK (200U)
+
+#define DEQUE_LEN (1024U)
+
+#define MAX_WORKERS (256U)
+
+static const uint64_t task_count = ( 2ULL << TREE_DEPTH ) - 1ULL;
+
+/** Stand-in for the work done by one task */
+static uint64_t do_work( const unsigned p_task )
+{
+    uint64_t x = p_task;
+    for( unsigned i = 0; i < TASK_WORK; i++ ) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return x;
+}
+
+/** The arrangement being replaced - all workers share a single list with
+    a mutex around each operation */
+class LockedPool
+{
+    private:
+        std::mutex m_lock;
+        FixedLengthList< unsigned, DEQUE_LEN * MAX_WORKERS > m_list;
+    public:
+        void start( const unsigned p_workers, const unsigned p_root ) {
+            m_list.clear();
+            m_list.push( p_root );
+        }
+        bool spawn( const unsigned p_worker, const unsigned p_task ) {
+            std::lock_guard< std::mutex > guard( m_lock );
+            return m_list.push( p_task );
+        }
+        bool next( const unsigned p_worker, const unsigned p_workers, unsigned* const p_task ) {
+            std::lock_guard< std::mutex > guard( m_lock );
+            return m_list.pop( p_task );
+        }
+};
+
+/** Each worker owns a deque, taking from its own front and stealing from
+    the back of the others in turn */
+class StealingPool
+{
+    private:
+        FixedLengthWorkStealingDeque< unsigned, DEQUE_LEN > m_deques[ MAX_WORKERS ];
+    public:
+        void start( const unsigned p_workers, const unsigned p_root ) {
+            m_deques[ 0 ].push( p_root );
+        }
+        bool spawn( const unsigned p_worker, const unsigned p_task ) {
+            return m_deques[ p_worker ].push( p_task );
+        }
+        bool next( const unsigned p_worker, const unsigned p_workers, unsigned* const p_task ) {
+            bool ret_val = m_deques[ p_worker ].pop( p_task );
+            for( unsigned v = 1; !ret_val && ( v < p_workers ); v++ ) {
+                ret_val = m_deques[ ( p_worker + v ) % p_workers ].dequeue( p_task );
+            }
+            return ret_val;
+        }
+};
+
+/** Run a task, pushing its children to the pool or running them in place
+    should the pool be full.  Tasks are encoded as ( depth << 24 ) | id.
+    Returns the number of tasks run */
+template < class Pool >
+static uint64_t run_task( Pool& p_pool, const unsigned p_worker, const unsigned p_task, uint64_t* const p_sum )
+{
+    uint64_t ret_val = 1U;
+    unsigned depth = p_task >> 24;
+
+    *p_sum += do_work( p_task );
+
+    if( depth > 0U ) {
+        unsigned child = ( ( depth - 1U ) << 24 ) | ( ( p_task * 2U ) & 0xFFFFFFU );
+        for( unsigned c = 0; c < 2U; c++ ) {
+            if( !p_pool.spawn( p_worker, child + c ) ) {
+                ret_val += run_task( p_pool, p_worker, child + c, p_sum );
+            }
+        }
+    }
+
+    return ret_val;
+}
+
+template < class Pool >
+static double mtasks_per_sec( Pool& p_pool, const unsigned p_threads )
+{
+    std::vector< std::thread > threads;
+    std::atomic< uint64_t > done( 0U );
+
+    p_pool.start( p_threads, TREE_DEPTH << 24 );
+
+    uint64_t start = bench_now_ns();
+
+    for( unsigned t = 0; t < p_threads; t++ ) {
+        threads.push_back( std::thread( [&p_pool, &done, t, p_threads]() {
+            uint64_t sum = 0;
+            unsigned task;
+            while( done.load( std::memory_order_relaxed ) < task_count ) {
+                if( p_pool.next( t, p_threads, &task ) ) {
+                    done.fetch_add( run_task( p_pool, t, task, &sum ), std::memory_order_relaxed );
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            bench_sink = sum;
+        } ) );
+    }
+
+    for( unsigned t = 0; t < p_threads; t++ ) {
+        threads[ t ].join();
+    }
+
+    uint64_t elapsed = bench_now_ns() - start;
+
+    return (double)task_count * 1e3 / (double)elapsed;
+}
+
+static LockedPool locked;
+static StealingPool stealing;
+
+int main( void )
+{
+    unsigned max_threads = std::thread::hardware_concurrency();
+
+    if( max_threads == 0 ) {
+        max_threads = 1;
+    } else if( max_threads > MAX_WORKERS ) {
+        max_threads = MAX_WORKERS;
+    }
+
+    printf( "%8s %20s %20s\n", "threads", "list+mutex Mtasks/s", "stealing Mtasks/s" );
+
+    for( unsigned t = 1; t <= max_threads; t = ( t < max_threads && t * 2 > max_threads ) ? max_threads : t * 2 ) {
+        printf( "%8u %20.2f %20.2f\n", t, mtasks_per_sec( locked, t ), mtasks_per_sec( stealing, t ) );
+    }
+
+    return 0;
+}
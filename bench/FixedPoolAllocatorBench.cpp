@@ -0,0 +1,94 @@
+/**
+   @file
+   @brief Benchmark for FixedPoolAllocator, comparing std::map insert/erase
+          using the pool with the default allocator.  Build with e.g.
+
+       g++ -O2 -std=c++11 -I../src FixedPoolAllocatorBench.cpp
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <map>
+
+#include "Bench.hpp"
+#include "FixedPoolAllocator.hpp"
+
+/** Number of insert/erase operations for each measurement */
+#define OPS (1U << 21)
+
+typedef std::pair< const uint32_t, uint32_t > entry_t;
+
+/** Keep the map at around half of its capacity, inserting and erasing
+    pseudo-random keys so that nodes are freed and reused out of order */
+template < class Map >
+static uint64_t run_map( const size_t p_capacity )
+{
+    Map m;
+    uint32_t seed = 1U;
+    uint64_t sum = 0;
+
+    uint64_t start = bench_now_ns();
+    for( unsigned n = 0; n < OPS; n++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+        uint32_t key = ( seed >> 8 ) % (uint32_t)p_capacity;
+
+        if( m.size() < ( p_capacity / 2U ) )
+        {
+            m[ key ] = n;
+        }
+        else
+        {
+            sum += m.erase( key );
+            m.erase( m.begin() );
+        }
+    }
+    uint64_t ns = bench_now_ns() - start;
+
+    bench_sink = sum + m.size();
+
+    return ns;
+}
+
+template < size_t capacity >
+static void run( void )
+{
+    typedef std::map< uint32_t, uint32_t > heap_map_t;
+    typedef std::map< uint32_t, uint32_t, std::less< uint32_t >, FixedPoolAllocator< entry_t, capacity > > pool_map_t;
+
+    uint64_t heap_ns = run_map< heap_map_t >( capacity );
+    uint64_t pool_ns = run_map< pool_map_t >( capacity );
+
+    printf( "%10u %16.2f %16.2f\n", (unsigned)capacity,
+            (double)heap_ns / OPS, (double)pool_ns / OPS );
+}
+
+int main( void )
+{
+    printf( "%10s %16s %16s\n", "capacity", "std ns/op", "pool ns/op" );
+
+    run< 64 >();
+    run< 1024 >();
+    run< 16384 >();
+    run< 262144 >();
+
+    return 0;
+}
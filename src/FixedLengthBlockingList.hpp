@@ -0,0 +1,455 @@
+/**
+   @file
+   @brief Template class ( FixedLengthBlockingList ) to implement a queue with
+          a limited number of elements, shared between threads, on which
+          consumers (and producers) may wait rather than spin.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHBLOCKINGLIST_HPP
+#define      FIXEDLENGTHBLOCKINGLIST_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "FixedLengthList.hpp"
+
+/**
+   Template class to implement a first-in, first-out queue with a fixed
+   maximum number of elements, shared between any number of producer and
+   consumer threads, where a thread finding the queue empty (or full) may
+   sleep until it is not, rather than spinning.
+
+   The queue is a FixedLengthList protected by a mutex.  Threads wait on a
+   condition variable - one for consumers waiting for an item, another for
+   producers waiting for space.  To keep the cost of the common case down,
+   a producer only signals when it takes the queue from empty to non-empty
+   (and a consumer only when it takes it from full to non-full), and then
+   only should any thread be waiting.  All waiting threads are woken on such
+   a transition, as further items may be queued before they run without
+   further signals.
+
+   pop_wait_n() takes all of the items available (up to a limit) at once, so
+   a consumer woken by the first item of a burst takes the rest of the burst
+   without waiting or being woken again.
+
+   Each of the waiting methods has a version taking a timeout.
+
+   The class requires C++11.
+
+   Example:
+   \code
+          FixedLengthBlockingList< Job, 64 > jobs;
+
+          // Producer
+          jobs.queue_wait( job );
+
+          // Consumer
+          Job batch[ 16 ];
+          for( ;; ) {
+             size_t count = jobs.pop_wait_n( batch, 16 );
+             // Process batch[ 0 ] to batch[ count - 1 ]
+          }
+    \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthBlockingList
+{
+    private:
+        /** Clock used for timeouts */
+        typedef std::chrono::steady_clock clock_type;
+
+        /** The list in use */
+        FixedLengthList< T, queueMax > m_list;
+
+        /** Protects all other members */
+        mutable std::mutex             m_lock;
+
+        /** Signalled when the list becomes non-empty */
+        std::condition_variable        m_notEmpty;
+
+        /** Signalled when the list becomes non-full */
+        std::condition_variable        m_notFull;
+
+        /** Number of threads waiting on m_notEmpty */
+        size_t                         m_popWaiters;
+
+        /** Number of threads waiting on m_notFull */
+        size_t                         m_queueWaiters;
+
+        /** Wait on p_cond until p_ready() returns true
+
+            \param p_guard Lock on m_lock, held
+            \param p_cond Condition to wait on
+            \param p_waiters Count of threads waiting on p_cond
+            \param p_ready Returns true once the wait is over
+            \param p_deadline Time at which to give up, or NULL to wait for as
+                              long as it takes
+            \returns true in the case that p_ready() returned true, false in
+                     the case that the deadline passed first */
+        template < class Ready >
+        static bool wait( std::unique_lock< std::mutex >& p_guard, std::condition_variable& p_cond, size_t& p_waiters,
+                          Ready p_ready, const clock_type::time_point* const p_deadline );
+
+        /** Release p_guard, then wake the threads waiting for an item should
+            the list have just become non-empty */
+        void added( std::unique_lock< std::mutex >& p_guard, const bool p_wasEmpty );
+
+        /** Release p_guard, then wake the threads waiting for space should
+            the list have just become non-full */
+        void removed( std::unique_lock< std::mutex >& p_guard, const bool p_wasFull );
+
+        /** Implementation of queue_wait() and queue_wait_for() */
+        bool queue_until( const T& p_item, const clock_type::time_point* const p_deadline );
+
+        /** Implementation of pop_wait() and pop_wait_for() */
+        bool pop_until( T* const p_item, const clock_type::time_point* const p_deadline );
+
+        /** Implementation of pop_wait_n() and pop_wait_n_for() */
+        size_t pop_n_until( T* const p_items, const size_t p_max, const clock_type::time_point* const p_deadline );
+
+        /** Convert a timeout into a deadline */
+        template < class Rep, class Period >
+        static clock_type::time_point deadline( const std::chrono::duration< Rep, Period >& p_timeout );
+
+    public:
+        /** Constructor for FixedLengthBlockingList */
+        FixedLengthBlockingList( void );
+
+        FixedLengthBlockingList( const FixedLengthBlockingList& ) = delete;
+        FixedLengthBlockingList& operator=( const FixedLengthBlockingList& ) = delete;
+
+        /**
+           queue an item onto the end of the list, without waiting
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool queue( const T& p_item );
+
+        /**
+           queue an item onto the end of the list, waiting for space should
+           the list be full
+
+           \param p_item The item to be added to the list */
+        void queue_wait( const T& p_item );
+
+        /**
+           As queue_wait(), giving up after a timeout
+
+           \param p_item The item to be added to the list
+           \param p_timeout Longest time to wait for space
+           \returns true in the case that the item was added
+                    false in the case that the timeout passed first */
+        template < class Rep, class Period >
+        bool queue_wait_for( const T& p_item, const std::chrono::duration< Rep, Period >& p_timeout );
+
+        /**
+           pop an item from the front of the list, without waiting
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (list empty)
+        */
+        bool pop( T* const p_item );
+
+        /**
+           pop an item from the front of the list, waiting for one should the
+           list be empty
+
+           \param p_item Pointer to be populated with the value of the item */
+        void pop_wait( T* const p_item );
+
+        /**
+           As pop_wait(), giving up after a timeout
+
+           \param p_item Pointer to be populated with the value of the item
+           \param p_timeout Longest time to wait for an item
+           \returns true in the case that an item was returned
+                    false in the case that the timeout passed first */
+        template < class Rep, class Period >
+        bool pop_wait_for( T* const p_item, const std::chrono::duration< Rep, Period >& p_timeout );
+
+        /**
+           pop up to p_max items from the front of the list, without waiting
+
+           \param p_items Array to be populated with the items
+           \param p_max Maximum number of items to pop (size of p_items)
+           \returns Number of items popped */
+        size_t pop_n( T* const p_items, const size_t p_max );
+
+        /**
+           pop up to p_max items from the front of the list, waiting for at
+           least one should the list be empty.  All of the items available
+           are taken at once, so a burst of items costs a single wake up
+
+           \param p_items Array to be populated with the items
+           \param p_max Maximum number of items to pop (size of p_items).
+                        Must be non-zero
+           \returns Number of items popped, at least 1 */
+        size_t pop_wait_n( T* const p_items, const size_t p_max );
+
+        /**
+           As pop_wait_n(), giving up after a timeout
+
+           \param p_items Array to be populated with the items
+           \param p_max Maximum number of items to pop (size of p_items).
+                        Must be non-zero
+           \param p_timeout Longest time to wait for an item
+           \returns Number of items popped, 0 in the case that the timeout
+                    passed first */
+        template < class Rep, class Period >
+        size_t pop_wait_n_for( T* const p_items, const size_t p_max, const std::chrono::duration< Rep, Period >& p_timeout );
+
+        /** Used to find out how many items are in the list.  Only a snapshot,
+            as other threads may be using the list
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the list.
+            Only a snapshot, as other threads may be using the list
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax >
+FixedLengthBlockingList< T, queueMax >::FixedLengthBlockingList( void ) : m_list(), m_popWaiters( 0U ), m_queueWaiters( 0U )
+{
+}
+
+template < class T, size_t queueMax >
+template < class Ready >
+bool FixedLengthBlockingList< T, queueMax >::wait( std::unique_lock< std::mutex >& p_guard, std::condition_variable& p_cond, size_t& p_waiters,
+                                                   Ready p_ready, const clock_type::time_point* const p_deadline )
+{
+    bool ret_val = p_ready();
+
+    if( !ret_val )
+    {
+        p_waiters++;
+
+        if( p_deadline == NULL )
+        {
+            p_cond.wait( p_guard, p_ready );
+            ret_val = true;
+        }
+        else
+        {
+            ret_val = p_cond.wait_until( p_guard, *p_deadline, p_ready );
+        }
+
+        p_waiters--;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+void FixedLengthBlockingList< T, queueMax >::added( std::unique_lock< std::mutex >& p_guard, const bool p_wasEmpty )
+{
+    bool wake = p_wasEmpty && ( m_popWaiters > 0U );
+
+    /* Notify having released the lock, so that the threads woken don't
+       immediately block on it */
+    p_guard.unlock();
+
+    if( wake )
+    {
+        m_notEmpty.notify_all();
+    }
+}
+
+template < class T, size_t queueMax >
+void FixedLengthBlockingList< T, queueMax >::removed( std::unique_lock< std::mutex >& p_guard, const bool p_wasFull )
+{
+    bool wake = p_wasFull && ( m_queueWaiters > 0U );
+
+    p_guard.unlock();
+
+    if( wake )
+    {
+        m_notFull.notify_all();
+    }
+}
+
+template < class T, size_t queueMax >
+template < class Rep, class Period >
+typename FixedLengthBlockingList< T, queueMax >::clock_type::time_point FixedLengthBlockingList< T, queueMax >::deadline( const std::chrono::duration< Rep, Period >& p_timeout )
+{
+    return clock_type::now() + std::chrono::duration_cast< clock_type::duration >( p_timeout );
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthBlockingList< T, queueMax >::queue_until( const T& p_item, const clock_type::time_point* const p_deadline )
+{
+    std::unique_lock< std::mutex > guard( m_lock );
+    bool ret_val = wait( guard, m_notFull, m_queueWaiters, [this]() { return m_list.available() > 0U; }, p_deadline );
+    bool was_empty = ( m_list.used() == 0U );
+
+    if( ret_val )
+    {
+        m_list.queue( p_item );
+    }
+
+    added( guard, ret_val && was_empty );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthBlockingList< T, queueMax >::pop_until( T* const p_item, const clock_type::time_point* const p_deadline )
+{
+    std::unique_lock< std::mutex > guard( m_lock );
+    bool ret_val = wait( guard, m_notEmpty, m_popWaiters, [this]() { return m_list.used() > 0U; }, p_deadline );
+    bool was_full = ( m_list.available() == 0U );
+
+    if( ret_val )
+    {
+        m_list.pop( p_item );
+    }
+
+    removed( guard, ret_val && was_full );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthBlockingList< T, queueMax >::pop_n_until( T* const p_items, const size_t p_max, const clock_type::time_point* const p_deadline )
+{
+    std::unique_lock< std::mutex > guard( m_lock );
+    size_t ret_val = 0U;
+    bool ready = wait( guard, m_notEmpty, m_popWaiters, [this]() { return m_list.used() > 0U; }, p_deadline );
+    bool was_full = ( m_list.available() == 0U );
+
+    if( ready )
+    {
+        ret_val = m_list.pop_n( p_items, p_max );
+    }
+
+    removed( guard, ( ret_val > 0U ) && was_full );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthBlockingList< T, queueMax >::queue( const T& p_item )
+{
+    std::unique_lock< std::mutex > guard( m_lock );
+    bool was_empty = ( m_list.used() == 0U );
+    bool ret_val = m_list.queue( p_item );
+
+    added( guard, ret_val && was_empty );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+void FixedLengthBlockingList< T, queueMax >::queue_wait( const T& p_item )
+{
+    queue_until( p_item, NULL );
+}
+
+template < class T, size_t queueMax >
+template < class Rep, class Period >
+bool FixedLengthBlockingList< T, queueMax >::queue_wait_for( const T& p_item, const std::chrono::duration< Rep, Period >& p_timeout )
+{
+    clock_type::time_point until = deadline( p_timeout );
+
+    return queue_until( p_item, &until );
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthBlockingList< T, queueMax >::pop( T* const p_item )
+{
+    std::unique_lock< std::mutex > guard( m_lock );
+    bool was_full = ( m_list.available() == 0U );
+    bool ret_val = m_list.pop( p_item );
+
+    removed( guard, ret_val && was_full );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+void FixedLengthBlockingList< T, queueMax >::pop_wait( T* const p_item )
+{
+    pop_until( p_item, NULL );
+}
+
+template < class T, size_t queueMax >
+template < class Rep, class Period >
+bool FixedLengthBlockingList< T, queueMax >::pop_wait_for( T* const p_item, const std::chrono::duration< Rep, Period >& p_timeout )
+{
+    clock_type::time_point until = deadline( p_timeout );
+
+    return pop_until( p_item, &until );
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthBlockingList< T, queueMax >::pop_n( T* const p_items, const size_t p_max )
+{
+    std::unique_lock< std::mutex > guard( m_lock );
+    bool was_full = ( m_list.available() == 0U );
+    size_t ret_val = m_list.pop_n( p_items, p_max );
+
+    removed( guard, ( ret_val > 0U ) && was_full );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthBlockingList< T, queueMax >::pop_wait_n( T* const p_items, const size_t p_max )
+{
+    return pop_n_until( p_items, p_max, NULL );
+}
+
+template < class T, size_t queueMax >
+template < class Rep, class Period >
+size_t FixedLengthBlockingList< T, queueMax >::pop_wait_n_for( T* const p_items, const size_t p_max, const std::chrono::duration< Rep, Period >& p_timeout )
+{
+    clock_type::time_point until = deadline( p_timeout );
+
+    return pop_n_until( p_items, p_max, &until );
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthBlockingList< T, queueMax >::used() const
+{
+    std::lock_guard< std::mutex > guard( m_lock );
+
+    return m_list.used();
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthBlockingList< T, queueMax >::available() const
+{
+    return queueMax - used();
+}
+
+#endif
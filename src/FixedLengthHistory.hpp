@@ -0,0 +1,348 @@
+/**
+   @file
+   @brief Template class ( FixedLengthHistory ) to implement a ring holding
+          the most recent items added to it, each with a sequence number.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHHISTORY_HPP
+#define      FIXEDLENGTHHISTORY_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <stdint.h> // for uint64_t
+#include <algorithm> // for min(), max(), copy()
+
+#ifndef STATIC_ASSERT
+/** Emulation of C++11's static_assert */
+#define STATIC_ASSERT( condition, name ) typedef char assert_failed_ ## name [ (condition) ? 1 : -1 ]
+#endif
+
+/**
+   Template class to implement a ring which keeps the most recent queueMax
+   items added to it, as wanted for telemetry or trace buffers.  Where
+   FixedLengthList and FixedLengthRing refuse an item once full,
+   queue() here overwrites the oldest item, optionally returning it.
+
+   Each item queued is given the next of a sequence of 64-bit numbers,
+   starting from 0.  Since items are only added at the end and removed from
+   the front, the sequence numbers of the items held always run without gaps
+   from first_seq() to next_seq() - 1, and an item's position in storage
+   follows from its sequence number, so the numbers take no storage and any
+   item can be found in constant time.
+
+   Readers keep a cursor (the sequence number of the next item they want)
+   and catch up with read_since(), which copies out the items from the
+   cursor onwards, or peek_since(), which gives access to them where they
+   are held without copying.  Neither removes the items, so any number of
+   readers may follow the history at their own pace.  A reader whose cursor
+   is older than first_seq() has missed items which have been overwritten;
+   reading resumes at the oldest item held.
+
+   In the case that queueMax is a power of two, sequence numbers are mapped
+   onto positions by masking.
+
+   Note that the class currently is not thread safe.
+
+   Example:
+   \code
+          FixedLengthHistory< Sample, 1024 > history;
+          uint64_t cursor = 0;
+
+          // Writer, never blocked by a full history
+          history.queue( sample );
+
+          // Reader, taking everything new in runs held contiguously
+          const Sample* run;
+          size_t count;
+          if( cursor < history.first_seq() ) {
+             // Lost history.first_seq() - cursor samples
+          }
+          while( ( count = history.peek_since( cursor, &run ) ) > 0 ) {
+             write( fd, run, count * sizeof( Sample ) );
+             cursor = std::max( cursor, history.first_seq() ) + count;
+          }
+   \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthHistory
+{
+    /* Pointless to have a history with no space in it, so the various
+       methods shouldn't have to deal with this situation */
+    STATIC_ASSERT( queueMax > 0, History_must_have_a_non_zero_length );
+
+    private:
+        /** Storage for the items.  The item with sequence number n is held
+            in m_items[ n % queueMax ] */
+        T                       m_items[ queueMax ];
+
+        /** Sequence number to be given to the next item queued */
+        uint64_t                m_nextSeq;
+
+        /** Keep count of the number of used items in the history.  Ranges
+            between 0 and queueMax */
+        size_t                  m_usedCount;
+
+        /** Map a sequence number onto a position within m_items */
+        static size_t slot( const uint64_t p_seq );
+
+    public:
+        /** Constructor for FixedLengthHistory */
+        FixedLengthHistory( void );
+
+        /**
+           queue an item onto the end of the history, overwriting the oldest
+           item in the case that the history is full
+
+           \param p_item The item to be added to the history
+           \param p_evicted Pointer to be populated with the value of the item
+                            overwritten, if any.  May be NULL
+           \returns true in the case that an item was overwritten
+                    false in the case that there was space for the item */
+        bool queue( const T& p_item, T* const p_evicted = NULL );
+
+        /**
+           pop the oldest item from the history (item is removed and returned)
+
+           \param p_item Pointer to be populated with the value of the item
+           \param p_seq Pointer to be populated with the sequence number of
+                        the item.  May be NULL
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (history
+                    empty)
+        */
+        bool pop( T* const p_item, uint64_t* const p_seq = NULL );
+
+        /**
+           Retrieve the item with a particular sequence number
+
+           \param p_seq Sequence number of the item
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that the item was returned
+                    false in the case that the item is no longer (or not yet)
+                    held */
+        bool get( const uint64_t p_seq, T* const p_item ) const;
+
+        /**
+           Copy out the items from a reader's cursor onwards, oldest first,
+           and move the cursor on past them.  Should the cursor be older
+           than first_seq(), copying starts at the oldest item held.
+
+           \param p_seq Cursor - the sequence number of the first item wanted.
+                        Updated to the sequence number following the last
+                        item copied
+           \param p_items Array to be populated with the items
+           \param p_max Maximum number of items to copy
+           \returns Number of items copied */
+        size_t read_since( uint64_t* const p_seq, T* const p_items, const size_t p_max ) const;
+
+        /**
+           Give access to the items from a sequence number onwards without
+           copying them.  As items wrap around the end of the storage they
+           are returned in at most two runs - call again with the sequence
+           number following the run to get the next.  Should p_seq be older
+           than first_seq(), the run starts at the oldest item held.  The
+           run is valid until the history is next changed.
+
+           \param p_seq Sequence number of the first item wanted
+           \param p_items Pointer to be populated with the first item in the
+                          run
+           \returns Number of items in the run, 0 in the case that there are
+                    no items from p_seq onwards */
+        size_t peek_since( const uint64_t p_seq, const T** const p_items ) const;
+
+        /** Sequence number of the oldest item held.  Equal to next_seq() when
+            the history is empty */
+        uint64_t first_seq( void ) const;
+
+        /** Sequence number which will be given to the next item queued */
+        uint64_t next_seq( void ) const;
+
+        /** Used to find out how many items are in the history
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many items can be queued before items are
+            overwritten
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        /** Remove the entire contents of the history.  Sequence numbers carry
+            on from where they were, so readers' cursors remain valid */
+        void clear( void );
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax >
+FixedLengthHistory< T, queueMax >::FixedLengthHistory( void ) : m_nextSeq( 0U ), m_usedCount( 0U )
+{
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthHistory< T, queueMax >::slot( const uint64_t p_seq )
+{
+    /* queueMax is a constant, so this reduces to a mask where it's a power
+       of two */
+    return (size_t)( p_seq % queueMax );
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthHistory< T, queueMax >::queue( const T& p_item, T* const p_evicted )
+{
+    bool ret_val = false;
+    T& item = m_items[ slot( m_nextSeq ) ];
+
+    /* Full, so the slot for the new item holds the oldest */
+    if( m_usedCount == queueMax )
+    {
+        if( p_evicted != NULL )
+        {
+            *p_evicted = item;
+        }
+
+        ret_val = true;
+    }
+    else
+    {
+        m_usedCount++;
+    }
+
+    item = p_item;
+    m_nextSeq++;
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthHistory< T, queueMax >::pop( T* const p_item, uint64_t* const p_seq )
+{
+    bool ret_val = false;
+
+    if( m_usedCount > 0U )
+    {
+        uint64_t seq = first_seq();
+
+        *p_item = m_items[ slot( seq ) ];
+
+        if( p_seq != NULL )
+        {
+            *p_seq = seq;
+        }
+
+        m_usedCount--;
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthHistory< T, queueMax >::get( const uint64_t p_seq, T* const p_item ) const
+{
+    bool ret_val = false;
+
+    if( ( p_seq >= first_seq() ) && ( p_seq < m_nextSeq ) )
+    {
+        *p_item = m_items[ slot( p_seq ) ];
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthHistory< T, queueMax >::read_since( uint64_t* const p_seq, T* const p_items, const size_t p_max ) const
+{
+    size_t ret_val = 0U;
+    uint64_t seq = std::max( *p_seq, first_seq() );
+    const T* run;
+    size_t count;
+
+    while( ( ret_val < p_max ) && ( ( count = peek_since( seq, &run ) ) > 0U ) )
+    {
+        count = std::min( count, p_max - ret_val );
+        std::copy( run, run + count, p_items + ret_val );
+
+        ret_val += count;
+        seq += count;
+    }
+
+    *p_seq = seq;
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthHistory< T, queueMax >::peek_since( const uint64_t p_seq, const T** const p_items ) const
+{
+    size_t ret_val = 0U;
+    uint64_t seq = std::max( p_seq, first_seq() );
+
+    if( seq < m_nextSeq )
+    {
+        size_t pos = slot( seq );
+
+        /* Up to the newest item, or the end of the storage, whichever comes
+           first */
+        ret_val = std::min( (size_t)( m_nextSeq - seq ), queueMax - pos );
+        *p_items = &( m_items[ pos ] );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+uint64_t FixedLengthHistory< T, queueMax >::first_seq( void ) const
+{
+    return m_nextSeq - m_usedCount;
+}
+
+template < class T, size_t queueMax >
+uint64_t FixedLengthHistory< T, queueMax >::next_seq( void ) const
+{
+    return m_nextSeq;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthHistory< T, queueMax >::used() const
+{
+    return m_usedCount;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthHistory< T, queueMax >::available() const
+{
+    return queueMax - m_usedCount;
+}
+
+template < class T, size_t queueMax >
+void FixedLengthHistory< T, queueMax >::clear( void )
+{
+    m_usedCount = 0U;
+}
+
+#endif
@@ -0,0 +1,512 @@
+/**
+   @file
+   @brief Template class ( FixedLengthLRUCache ) to implement a key/value
+          cache with a limited number of entries, discarding the least
+          recently used entry when full.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHLRUCACHE_HPP
+#define      FIXEDLENGTHLRUCACHE_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <new> // for placement new
+
+#include "FixedLengthListLinks.hpp"
+#include "FixedLengthListHashIndex.hpp"
+
+/** An entry within a FixedLengthLRUCache */
+template < class K, class V > class FixedLengthLRUCacheEntry
+{
+    public:
+        FixedLengthLRUCacheEntry( const K& p_key, const V& p_value ) : m_key( p_key ), m_value( p_value ) {}
+
+        K m_key;
+        V m_value;
+};
+
+/** Adapts the key hash and comparison for a FixedLengthLRUCache to the
+    cache's entries, for use by FixedLengthListHashIndex */
+template < class K, class V, class Hash, class Equal > class FixedLengthLRUCacheKey
+{
+    public:
+        size_t operator()( const K& p_key ) const { return m_hash( p_key ); }
+        size_t operator()( const FixedLengthLRUCacheEntry< K, V >& p_entry ) const { return m_hash( p_entry.m_key ); }
+        bool operator()( const FixedLengthLRUCacheEntry< K, V >& p_entry, const K& p_key ) const { return m_equal( p_entry.m_key, p_key ); }
+
+    private:
+        Hash  m_hash;
+        Equal m_equal;
+};
+
+/**
+   Template class to implement a cache of up to cacheMax key/value pairs,
+   which discards the least recently used entry to make room for a new one.
+
+   The cache is built from the same parts as FixedLengthList: a static pool
+   of entries (using FixedLengthListCompactDoubleLinks), a free stack and a
+   list of the entries in use, which is kept in order of use with the most
+   recently used at the head.  A FixedLengthListHashIndex over the keys
+   finds an entry without walking the list.  Looking up an entry, moving it
+   to the head of the list and discarding the entry at the tail are
+   therefore all constant time (expected, for the lookup).  No dynamic
+   memory is used.
+
+   Hash is a function object returning a size_t for a key, and Equal
+   compares two keys, as for FixedLengthListHashIndex.
+
+   The cache counts lookups by get() which found (hits) or did not find
+   (misses) an entry.
+
+   As with FixedLengthList, entries are only constructed while in the
+   cache.  Note that the class currently is not thread safe.
+
+   Example:
+   \code
+          struct IdHash {
+             size_t operator()( const unsigned p_id ) const {
+                return p_id * 2654435761U;
+             }
+          };
+
+          FixedLengthLRUCache< unsigned, Route, 256, IdHash > routes;
+
+          bool lookup( const unsigned p_id, Route* const p_route ) {
+             bool found = routes.get( p_id, p_route );
+             if( !found ) {
+                found = slow_lookup( p_id, p_route );
+                if( found ) {
+                   routes.put( p_id, *p_route );
+                }
+             }
+             return found;
+          }
+   \endcode
+*/
+template < class K, class V, size_t cacheMax, class Hash, class Equal = FixedLengthListEqual > class FixedLengthLRUCache
+{
+    /* Pointless to have a cache with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    STATIC_ASSERT( cacheMax > 0, Cache_must_have_a_non_zero_length );
+
+    private:
+        /** Type of the entries held in the pool */
+        typedef FixedLengthLRUCacheEntry< K, V > entry_t;
+
+        /** The link policy in use.  Backward links are needed to unlink an
+            entry in constant time */
+        typedef FixedLengthListCompactDoubleLinks< entry_t, cacheMax > links_t;
+
+        /** Type used by the link policy to refer to an entry */
+        typedef typename links_t::link_t link_t;
+
+        /** Key to entry index */
+        typedef typename FixedLengthListHashIndex< FixedLengthLRUCacheKey< K, V, Hash, Equal >,
+                                                   FixedLengthLRUCacheKey< K, V, Hash, Equal > >::template table< links_t, cacheMax > index_t;
+
+        /** Pool of entries, along with the links between them */
+        links_t                 m_items;
+
+        /** Index of the entries in use, by key */
+        index_t                 m_index;
+
+        /** Link to the start of the stack of free entries.  Will be nil in
+            the case that there are none (which does not mean that the cache
+            is full, see m_highWater) */
+        link_t                  m_freeHead;
+
+        /** Link to the most recently used entry.  Will be nil in the case
+            that the cache is empty */
+        link_t                  m_usedHead;
+
+        /** Link to the least recently used entry.  Will be nil in the case
+            that the cache is empty */
+        link_t                  m_usedTail;
+
+        /** Number of entries in use */
+        size_t                  m_usedCount;
+
+        /** Number of entries which have been used since the cache was last
+            cleared, as FixedLengthList */
+        size_t                  m_highWater;
+
+        /** Number of calls to get() which found an entry */
+        size_t                  m_hits;
+
+        /** Number of calls to get() which did not find an entry */
+        size_t                  m_misses;
+
+        /** Link an entry in as the most recently used */
+        void link_front( const link_t p_item );
+
+        /** Unlink an entry from the list of entries in use */
+        void unlink( const link_t p_item );
+
+        /** Remove an entry from the cache, returning it to the free stack
+
+            \param p_item Entry to be removed
+            \param p_key Pointer to be populated with the entry's key (moved
+                         out, in C++11).  May be NULL
+            \param p_value Pointer to be populated with the entry's value
+                           (moved out, in C++11).  May be NULL */
+        void remove_entry( const link_t p_item, K* const p_key = NULL, V* const p_value = NULL );
+
+        /* Not copyable */
+        FixedLengthLRUCache( const FixedLengthLRUCache& );
+        FixedLengthLRUCache& operator=( const FixedLengthLRUCache& );
+
+    public:
+        /** Constructor for FixedLengthLRUCache */
+        FixedLengthLRUCache( void );
+
+        /** Destructor for FixedLengthLRUCache.  Destroys any entries in the
+            cache */
+        ~FixedLengthLRUCache( void );
+
+        /**
+           look up the value for a key, making the entry the most recently
+           used in the case that it is found
+
+           \param p_key Key to be looked up
+           \param p_value Pointer to be populated with the value, in the case
+                          that it is found
+           \returns true in the case that the key was found (a hit)
+                    false in the case that the key was not found (a miss)
+        */
+        bool get( const K& p_key, V* const p_value );
+
+        /**
+           look up the value for a key without affecting the order of use or
+           the hit/miss counts
+
+           \param p_key Key to be looked up
+           \returns Pointer to the value in the cache, or NULL in the case
+                    that the key was not found.  Only valid until the cache
+                    is next modified
+        */
+        const V* peek( const K& p_key ) const;
+
+        /**
+           add an entry to the cache or, in the case that the key is already
+           in the cache, replace its value.  Either way, the entry becomes
+           the most recently used.  In the case that the cache is full, the
+           least recently used entry is discarded to make room
+
+           \param p_key Key for the entry
+           \param p_value Value for the entry
+           \param p_evictedKey Pointer to be populated with the key of the
+                               discarded entry, may be NULL
+           \param p_evictedValue Pointer to be populated with the value of the
+                                 discarded entry, may be NULL
+           \returns true in the case that an entry was discarded
+                    false in the case that no entry was discarded
+        */
+        bool put( const K& p_key, const V& p_value, K* const p_evictedKey = NULL, V* const p_evictedValue = NULL );
+
+        /**
+           remove the entry for a key from the cache
+
+           \param p_key Key for the entry
+           \returns true in the case that an entry was removed
+                    false in the case that the key was not found
+        */
+        bool remove( const K& p_key );
+
+        /** Determine whether or not a key is in the cache, without affecting
+            the order of use or the hit/miss counts */
+        bool contains( const K& p_key ) const;
+
+        /** Used to find out how many entries are in the cache
+
+            \returns Number of used entries, ranging from 0 to cacheMax */
+        size_t used() const;
+
+        /** Used to find out how many entries may be added before entries are
+            discarded
+
+            \returns Number of available entries, ranging from 0 to cacheMax */
+        size_t available() const;
+
+        /** Number of calls to get() which found the key, since construction or
+            the last reset_stats() */
+        size_t hits() const;
+
+        /** Number of calls to get() which did not find the key, since
+            construction or the last reset_stats() */
+        size_t misses() const;
+
+        /** Reset the hit and miss counts to zero */
+        void reset_stats( void );
+
+        /** Remove (and destroy) the entire contents of the cache.  The hit
+            and miss counts are not affected */
+        void clear( void );
+};
+
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::FixedLengthLRUCache( void ) : m_freeHead( links_t::nil() ),
+                                                                                 m_usedHead( links_t::nil() ),
+                                                                                 m_usedTail( links_t::nil() ),
+                                                                                 m_usedCount( 0U ),
+                                                                                 m_highWater( 0U ),
+                                                                                 m_hits( 0U ),
+                                                                                 m_misses( 0U )
+{
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::~FixedLengthLRUCache( void )
+{
+    clear();
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+void FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::link_front( const link_t p_item )
+{
+    m_items.set_prev( p_item, links_t::nil() );
+    m_items.set_next( p_item, m_usedHead );
+
+    if( m_usedHead != links_t::nil() )
+    {
+        m_items.set_prev( m_usedHead, p_item );
+    }
+    else
+    {
+        m_usedTail = p_item;
+    }
+
+    m_usedHead = p_item;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+void FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::unlink( const link_t p_item )
+{
+    link_t prev = m_items.prev( p_item );
+    link_t next = m_items.next( p_item );
+
+    if( prev == links_t::nil() )
+    {
+        m_usedHead = next;
+    }
+    else
+    {
+        m_items.set_next( prev, next );
+    }
+
+    if( next == links_t::nil() )
+    {
+        m_usedTail = prev;
+    }
+    else
+    {
+        m_items.set_prev( next, prev );
+    }
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+void FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::remove_entry( const link_t p_item, K* const p_key, V* const p_value )
+{
+    /* Take the entry out of the index before its key is moved from, as the
+       index finds it by its key */
+    m_index.index_erase( m_items, p_item );
+
+    if( p_key != NULL )
+    {
+        *p_key = FIXEDLENGTHLIST_MOVE( m_items.item( p_item ).m_key );
+    }
+    if( p_value != NULL )
+    {
+        *p_value = FIXEDLENGTHLIST_MOVE( m_items.item( p_item ).m_value );
+    }
+
+    unlink( p_item );
+    m_items.item( p_item ).~entry_t();
+
+    /* Move entry to free stack */
+    m_items.set_next( p_item, m_freeHead );
+    m_freeHead = p_item;
+
+    m_usedCount--;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+bool FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::get( const K& p_key, V* const p_value )
+{
+    bool ret_val = false;
+    link_t p = m_index.index_find( m_items, p_key );
+
+    if( p != links_t::nil() )
+    {
+        *p_value = m_items.item( p ).m_value;
+
+        /* Entry becomes the most recently used */
+        if( p != m_usedHead )
+        {
+            unlink( p );
+            link_front( p );
+        }
+
+        m_hits++;
+        ret_val = true;
+    }
+    else
+    {
+        m_misses++;
+    }
+
+    return ret_val;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+const V* FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::peek( const K& p_key ) const
+{
+    const V* ret_val = NULL;
+    link_t p = m_index.index_find( m_items, p_key );
+
+    if( p != links_t::nil() )
+    {
+        ret_val = &( m_items.item( p ).m_value );
+    }
+
+    return ret_val;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+bool FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::put( const K& p_key, const V& p_value, K* const p_evictedKey, V* const p_evictedValue )
+{
+    bool ret_val = false;
+    link_t p = m_index.index_find( m_items, p_key );
+
+    if( p != links_t::nil() )
+    {
+        /* Already in the cache - just update the value */
+        m_items.item( p ).m_value = p_value;
+
+        if( p != m_usedHead )
+        {
+            unlink( p );
+            link_front( p );
+        }
+    }
+    else
+    {
+        /* Make room, if necessary, by discarding the least recently used
+           entry */
+        if( m_usedCount == cacheMax )
+        {
+            remove_entry( m_usedTail, p_evictedKey, p_evictedValue );
+            ret_val = true;
+        }
+
+        /* Take a free entry, or one from above the high water mark */
+        if( m_freeHead != links_t::nil() )
+        {
+            p = m_freeHead;
+            m_freeHead = m_items.next( p );
+        }
+        else
+        {
+            p = m_items.slot( m_highWater++ );
+        }
+
+        ::new( static_cast<void*>( &( m_items.item( p ) ) ) ) entry_t( p_key, p_value );
+        m_index.index_insert( m_items, p );
+        link_front( p );
+
+        m_usedCount++;
+    }
+
+    return ret_val;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+bool FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::remove( const K& p_key )
+{
+    bool ret_val = false;
+    link_t p = m_index.index_find( m_items, p_key );
+
+    if( p != links_t::nil() )
+    {
+        remove_entry( p );
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+bool FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::contains( const K& p_key ) const
+{
+    return m_index.index_find( m_items, p_key ) != links_t::nil();
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+size_t FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::used() const
+{
+    return m_usedCount;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+size_t FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::available() const
+{
+    return cacheMax - m_usedCount;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+size_t FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::hits() const
+{
+    return m_hits;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+size_t FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::misses() const
+{
+    return m_misses;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+void FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::reset_stats( void )
+{
+    m_hits = 0U;
+    m_misses = 0U;
+}
+
+template < class K, class V, size_t cacheMax, class Hash, class Equal >
+void FixedLengthLRUCache< K, V, cacheMax, Hash, Equal >::clear( void )
+{
+    for( link_t p = m_usedHead;
+         p != links_t::nil();
+         p = m_items.next( p ) )
+    {
+        m_index.index_erase( m_items, p );
+        m_items.item( p ).~entry_t();
+    }
+
+    /* As FixedLengthList, all entries are now above the high water mark */
+    m_freeHead = links_t::nil();
+    m_usedHead = links_t::nil();
+    m_usedTail = links_t::nil();
+    m_usedCount = 0U;
+    m_highWater = 0U;
+}
+
+#endif
@@ -29,29 +29,44 @@ limitations under the License.
 #include <cstddef> // for size_t, NULL
 #include <cstring> // For memset()
 #include <algorithm> // for min()
+#include <iterator> // for iterator tags
+#include <new> // for placement new
+
+#include "FixedLengthListLinks.hpp"
+#include "FixedLengthListHashIndex.hpp"
+#include "FixedLengthListStats.hpp"
+#include "FixedLengthListSnapshot.hpp"
 
 #ifndef STATIC_ASSERT
 /** Emulation of C++11's static_assert */
 #define STATIC_ASSERT( condition, name ) typedef char assert_failed_ ## name [ (condition) ? 1 : -1 ]
 #endif
 
-/*
-    Each item in the FixedLengthList is wrapped in a
-    FixedLengthListItem which provides the actual item and
-    infrastructure support for the list */
-template < class L > class FixedLengthListItem
+/** Selects the iterator category for FixedLengthListIter.  Items can only
+    be stepped backwards in the case that the link policy maintains backward
+    links */
+template < bool doubly_linked > struct FixedLengthListIterCategory
 {
-    public:
-        /** Pointer to the next item in the list */
-        FixedLengthListItem<L>* m_forward;
-        /** The content/value of the item itself */
-        L                       m_item;
+    typedef std::forward_iterator_tag type;
 };
 
+template <> struct FixedLengthListIterCategory< true >
+{
+    typedef std::bidirectional_iterator_tag type;
+};
 
 /**
     Iterator support class for FixedLengthList
 
+    V is the type yielded by dereferencing the iterator, T for an iterator
+    and const T for a const_iterator.  The iterator is a forward iterator,
+    or bidirectional in the case that the link policy maintains backward
+    links.
+
+    As well as its position, the iterator keeps track of the item before it
+    as it is moved forward, so that FixedLengthList::erase() can unlink the
+    item in constant time even when there are no backward links.
+
    Example:
    \code
           #define LIST_LEN (20U)
@@ -72,24 +87,63 @@ template < class L > class FixedLengthListItem
           }
    \endcode
 */
-template< class T, size_t queueMax > class FixedLengthListIter
+template< class T, size_t queueMax, template < class, size_t > class Links = FixedLengthListSingleLinks, class V = T > class FixedLengthListIter
 {
+    /* Allow conversion from iterator to const_iterator, and access to the
+       position by the list */
+    template < class, size_t, template < class, size_t > class, class > friend class FixedLengthListIter;
+    template < class, size_t, template < class, size_t > class, class, class > friend class FixedLengthList;
+
     protected:
+        /** The list's link policy */
+        typedef Links< T, queueMax > links_t;
+
+        /** Type used by the list's link policy to refer to an item */
+        typedef typename links_t::link_t link_t;
+
+        /** The pool of items within the FixedLengthList */
+        links_t* m_links;
+
         /** The iterator hooks into the used list within the FixedLengthList */
-        FixedLengthListItem<T>* m_item;
+        link_t m_item;
+
+        /** The item preceding m_item, as far as is known.  nil in the case
+            that it is not known, or m_item is the head of the list */
+        link_t m_prev;
+
+        /** The list's tail, used to step back from end().  NULL in the case
+            that this is not supported */
+        const link_t* m_tail;
     public:
+        typedef typename FixedLengthListIterCategory< links_t::doubly_linked != 0 >::type iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef V * pointer;
+        typedef V & reference;
+
         /** Void constructor - iterator will be equal to T::end() */
         FixedLengthListIter( void );
         /** Construct an iterator which points to a list item within a
-            FixedLengthList */
-        FixedLengthListIter( FixedLengthListItem<T>* p_item );
+            FixedLengthList
+
+            \param p_links The pool of items
+            \param p_item The item pointed to, nil for end()
+            \param p_tail The list's tail, used by operator--().  May be NULL
+                          in the case that the iterator is not to be stepped
+                          back from end() */
+        FixedLengthListIter( links_t* p_links, link_t p_item, const link_t* p_tail = NULL );
+        /** Construct a const_iterator from an iterator */
+        template < class W > FixedLengthListIter( const FixedLengthListIter< T, queueMax, Links, W >& p_other );
         /** De-reference operator, yields the value of the list item */
-        T& operator*();
+        V& operator*() const;
+        /** Member access operator, yields the address of the list item */
+        V* operator->() const;
         /** Inequality operator */
         bool operator!=( const FixedLengthListIter& p_comp ) const;
         /** Equality operator */
         bool operator==( const FixedLengthListIter& p_comp ) const;
-        /** Move the iterator forward a specified number of list elements
+        /** Move the iterator forward a specified number of list elements.
+            Linear in p_inc
  
             \param p_inc Number of items to traverse */
         FixedLengthListIter& operator+=( const unsigned p_inc );
@@ -97,6 +151,14 @@ template< class T, size_t queueMax > class FixedLengthListIter
         FixedLengthListIter operator++( int p_int );
         /** Pre-increment operator */
         FixedLengthListIter& operator++( void );
+        /** Post-decrement operator.  Only valid in the case that the link
+            policy maintains backward links, otherwise the iterator becomes
+            end() (or the tail, if stepping back from end()) */
+        FixedLengthListIter operator--( int p_int );
+        /** Pre-decrement operator.  Only valid in the case that the link
+            policy maintains backward links, otherwise the iterator becomes
+            end() (or the tail, if stepping back from end()) */
+        FixedLengthListIter& operator--( void );
 };
 
 
@@ -120,13 +182,69 @@ template< class T, size_t queueMax > class FixedLengthListIter
    convenience both a head and tail pointer of the used list
    are maintained.
 
-   Note that the class currently is not thread safe.
+   The way in which items are stored and linked is determined by the Links
+   policy (see FixedLengthListLinks.hpp).  The default,
+   FixedLengthListSingleLinks, gives the singly linked list described above,
+   in which dequeue() must walk the list to find the new tail.  Using
+   FixedLengthListDoubleLinks adds a backward link to each item, making
+   dequeue() constant time at the cost of an extra pointer per item.
+   FixedLengthListCompactSingleLinks and FixedLengthListCompactDoubleLinks
+   are equivalents which link items by index rather than by pointer, using
+   the smallest unsigned type able to address queueMax items.  This reduces
+   the footprint of the list and makes its storage position independent.
+
+   Slots are not threaded onto the free stack up front.  Instead, a high
+   water mark tracks how many slots have ever been used and further slots
+   are taken from above it once the free stack is empty.  Constructing or
+   clear()ing the list is therefore constant time (other than destroying
+   any items which are in it) regardless of queueMax.
+
+   With C++11 the default constructor is constexpr, and with C++14 so is the
+   constructor taking an array of known size, provided that T has a
+   constexpr copy constructor and no destructor and that the index and
+   instrumentation policies have constexpr constructors (as the defaults
+   do).  A list with static storage is then emitted as initialised data,
+   items and links included, rather than being built at start up.
+   FIXEDLENGTHLIST_CONSTINIT may be used to check this at compile time.
+
+   Items are only constructed while they are in the list: adding an item
+   copy- (or, with C++11, move-) constructs it in a free slot, and removing
+   it destroys it.  T therefore need not be default constructible.  With
+   C++11, items may also be constructed in place using emplace_front() and
+   emplace_back(), and pop() and dequeue() move the item out of the list.
+
+   By default inList() and remove() walk the list to find an item.  An
+   index policy (see FixedLengthListHashIndex.hpp) may be supplied as the
+   Index parameter to keep a hash table of the items alongside them, making
+   both constant time in the expected case.  remove() then also needs
+   backward links to unlink the item in constant time, so is best combined
+   with FixedLengthListDoubleLinks or FixedLengthListCompactDoubleLinks.
+   Alternatively FixedLengthListScanIndex (see FixedLengthListScanIndex.hpp)
+   keeps only a bitmask of the slots in use and finds items by scanning the
+   pool with vector compares.
+
+   An instrumentation policy (see FixedLengthListStats.hpp) may be supplied
+   as the Stats parameter to record the peak number of items, inserts
+   rejected as the list was full, operation counts and the length of
+   searches.  The default, FixedLengthListNoStats, records nothing and
+   compiles out completely.
+
+   Note that the class currently is not thread safe.  For passing items
+   between one producer and one consumer thread see FixedLengthSPSCQueue,
+   and for any number of threads see FixedLengthMPMCList.
 
    Example:
    \code
           #define LIST_LEN (20U)
           FixedLengthList<int,  LIST_LEN > list;
 
+          // List supporting O(1) dequeue()
+          FixedLengthList<int,  LIST_LEN, FixedLengthListDoubleLinks > deque;
+
+          // List built at compile time, containing 1, 2, 3
+          const int initial[] = { 1, 2, 3 };
+          FIXEDLENGTHLIST_CONSTINIT FixedLengthList<int,  LIST_LEN > preset( initial );
+
           int main( void ) {
              int i;
              
@@ -149,44 +267,187 @@ template< class T, size_t queueMax > class FixedLengthListIter
           }
     \endcode
 */
-template < class T, size_t queueMax > class FixedLengthList
+template < class T, size_t queueMax, template < class, size_t > class Links = FixedLengthListSingleLinks, class Index = FixedLengthListNoIndex, class Stats = FixedLengthListNoStats > class FixedLengthList
+    : private Index::template table< Links< T, queueMax >, queueMax >,
+      private Stats
 {
     /* Pointless to have a queue with no space in it, so the various methods
        shouldn't have to deal with this situation */
     STATIC_ASSERT( queueMax > 0, Queue_must_have_a_non_zero_length );
 
     private:
+        /** The link policy in use */
+        typedef Links< T, queueMax > links_t;
 
-        /** Pool of list items */
-        FixedLengthListItem<T>  m_items[ queueMax ];
+        /** Type used by the link policy to refer to an item */
+        typedef typename links_t::link_t link_t;
 
+        /** The index in use, if any */
+        typedef typename Index::template table< links_t, queueMax > index_t;
 
-        /** Pointer to the start of the queue of free list slots.  Will be NULL
+        /** Pool of list items, along with the links between them */
+        links_t                 m_items;
+
+        /** Link to the start of the queue of free list slots.  Will be nil
             in the case that there none are available */
-        FixedLengthListItem<T>* m_freeHead;
+        link_t                  m_freeHead;
 
-        /** Pointer to the first item in the list of utilised item slots.  Will
-            be NULL in the case that there are none */
-        FixedLengthListItem<T>* m_usedHead;
+        /** Link to the first item in the list of utilised item slots.  Will
+            be nil in the case that there are none */
+        link_t                  m_usedHead;
 
-        /** Pointer to the last item in the list of utilised item slots.  Will
-            be NULL in the case that there are none */
-        FixedLengthListItem<T>* m_usedTail;
+        /** Link to the last item in the list of utilised item slots.  Will
+            be nil in the case that there are none */
+        link_t                  m_usedTail;
 
         /** Keep count of the number of used items on the list.  Ranges between
             0 and queueMax */
         size_t                  m_usedCount;
 
+        /** Number of slots which have been used since the list was last
+            reset.  Slots from this point onwards have never been threaded
+            onto the free stack, so are not reachable from m_freeHead */
+        size_t                  m_highWater;
+
+        /** Find the first free item, taking a new slot from above the high
+            water mark in the case that the free stack is empty.  The item
+            is left at the head of the free stack.
+
+            \returns The first free item, or nil in the case that the list is
+                     full
+        */
+        link_t free_head( void );
+
+        /** Find the item preceding the specified item in the list of used
+            items.  Constant time in the case that the link policy maintains
+            backward links, otherwise the list is walked from the head.
+
+            \param p_item Item whose predecessor is required.  Note that item
+                          must exist in the list of used items
+            \returns The preceding item, or nil in the case that p_item is the
+                     head of the list
+        */
+        link_t prev_node( const link_t p_item ) const;
+
         /** Remove the specified item from the list.
 
-            \p_item Item to be removed.  Note that item must exist in the list
-                    of used items
+            \param p_item Item to be removed.  Note that item must exist in the
+                          list of used items
+            \param p_prev The item preceding p_item in the list of used items,
+                          or nil in the case that p_item is the head
+            \param p_out Pointer to be populated with the value of the item
+                         (moved out, in C++11).  May be NULL.  The item is
+                         removed from the index first, while it still holds
+                         the value it was indexed under
         */
-        void remove_node( FixedLengthListItem<T>* p_item );
+        void remove_node( const link_t p_item, const link_t p_prev, T* const p_out = NULL );
+
+        /** Take the item at the head of the free stack (which must have been
+            constructed) and link it in at the start of the used list */
+        void link_front( void );
+
+        /** Take the item at the head of the free stack (which must have been
+            constructed) and link it in at the end of the used list */
+        void link_back( void );
+
+        /** Take the item at the head of the free stack (which must have been
+            constructed) and link it in after p_pos in the used list
+
+            \param p_pos Item in the used list which the new item is to
+                         follow */
+        void link_after( const link_t p_pos );
+
+        /** Construct p_dst from the item p_src (by moving, in C++11), then
+            destroy p_src */
+        static void relocate( T& p_dst, T& p_src );
+
+        /** Destroy all of the items in the used list (removing them from the
+            index), leaving the links untouched */
+        void destroy_items( void );
+
+        /** Return all of the items to the free state, without destroying
+            them.  Constant time */
+        void reset( void );
+
+        /** Link the first m_usedCount slots into the used list in order,
+            adding them to the index.  All other slots are left free, above
+            the high water mark */
+        void link_in_order( void );
+
+        /** Remove the item at the front of the list should the list be full,
+            for queue_overwrite()
+
+            \param p_evicted Pointer to be populated with the value of the
+                             item removed.  May be NULL
+            \returns true in the case that an item was removed */
+        bool make_space( T* const p_evicted );
+
+        /** Link slot p_index to its neighbours for link_in_order(), adding it
+            to the index */
+        void link_slot( const size_t p_index );
+
+        /** Set the ends of the list and the free slots for link_in_order(),
+            once each slot has been linked */
+        void link_ends( void );
+
+        /** Skip p_size bytes of p_stream
+
+            \returns true in the case that the bytes were skipped */
+        template < class Stream > static bool skip( Stream& p_stream, size_t p_size );
+
+        /** Copy construct items from p_items into p_count free slots, of
+            which there must be at least p_count.  The slots are taken from
+            the free stack and left forward and backward linked to each
+            other, but not to the used list
+
+            \returns The last item in the run.  The first is that returned by
+                     free_head() prior to the call */
+        link_t construct_run( const T* const p_items, const size_t p_count );
+
+        /** Link a run of items built by construct_run() in at the start of
+            the used list */
+        void link_run_front( const link_t p_first, const link_t p_last, const size_t p_count );
+
+        /** Link a run of items built by construct_run() in at the end of the
+            used list */
+        void link_run_back( const link_t p_first, const link_t p_last, const size_t p_count );
+
+        /** Destroy a run of p_count items in the used list, ending with p_last,
+            and move them all to the free stack in one go.  The items must
+            already have been removed from the index, before any were moved
+            out
+
+            \param p_before The item preceding the run, nil if the run starts
+                            at the head of the list */
+        void free_run( const link_t p_before, const link_t p_last, const size_t p_count );
 
     public:
-        /** Constructor for FixedLengthList */
-        FixedLengthList( void );
+        /** Constructor for FixedLengthList.  Constant time, and constexpr
+            where supported */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthList( void );
+
+        /** Copy constructor for FixedLengthList.  Items are copied in list
+            order */
+        FixedLengthList( const FixedLengthList& p_other );
+
+        /** Destructor for FixedLengthList.  Destroys any items in the list */
+        ~FixedLengthList( void );
+
+        /** Assignment operator for FixedLengthList.  Existing items are
+            destroyed, then items are copied in list order */
+        FixedLengthList& operator=( const FixedLengthList& p_other );
+
+#if FIXEDLENGTHLIST_CXX11
+        /** Move constructor for FixedLengthList.  As items are held within
+            the list itself they are moved individually, in list order.
+            p_other is left empty */
+        FixedLengthList( FixedLengthList&& p_other );
+
+        /** Move assignment operator for FixedLengthList.  Existing items are
+            destroyed, then items are moved individually, in list order.
+            p_other is left empty */
+        FixedLengthList& operator=( FixedLengthList&& p_other );
+#endif
 
         /** Initialising constructor for FixedLengthList.  Parameters will be
             used to initialise the list
@@ -199,18 +460,48 @@ template < class T, size_t queueMax > class FixedLengthList
                            ignored */
         FixedLengthList( const T* const p_items, size_t p_count );
 
+#if FIXEDLENGTHLIST_CXX14
+        /** Initialising constructor for FixedLengthList, taking an array of
+            known size.  Equivalent to the constructor above, but may be
+            evaluated at compile time (see the class description)
+
+            \param p_items An array of items used to initialise the list.  They
+                           will be added in the order in which they appear in
+                           p_items.  There must be no more than queueMax */
+        template < size_t count > constexpr FixedLengthList( const T ( &p_items )[ count ] );
+#endif
+
         /**
            push an item onto the front of the list
 
            \param p_item The item to be added to the list
            \returns true in the case that the item was added
                     false in the case that the item was not added (no space) */
-        bool push( const T p_item );
+        bool push( const T& p_item );
+
+#if FIXEDLENGTHLIST_CXX11
+        /**
+           push an item onto the front of the list, moving it into place
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool push( T&& p_item );
+
+        /**
+           construct an item in place at the front of the list
+
+           \param p_args Arguments to be passed to T's constructor
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        template < class... Args > bool emplace_front( Args&&... p_args );
+#endif
 
         /**
            pop an item from the front of the list (item is removed and returned
 
-           \param p_item Pointer to be populated with the value of the item
+           \param p_item Pointer to be populated with the value of the item.
+                         The item is moved out of the list where supported
            \returns true in the case that an item was returned
                     false in the case that an item was not returned (list empty)
         */
@@ -222,19 +513,158 @@ template < class T, size_t queueMax > class FixedLengthList
            \param p_item The item to be added to the list
            \returns true in the case that the item was added
                     false in the case that the item was not added (no space) */
-        bool queue( const T p_item );
+        bool queue( const T& p_item );
+
+        /**
+           queue an item onto the end of the list, making space should the
+           list be full by overwriting the item at the front of the list, so
+           that the list holds the most recent queueMax items.  The node at
+           the front is recycled for the new item, so this is constant time.
+           See FixedLengthHistory for a ring which also numbers the items.
+
+           \param p_item The item to be added to the list.  Must not refer to
+                         an item in the list
+           \param p_evicted Pointer to be populated with the value of the item
+                            overwritten, if any.  May be NULL
+           \returns true in the case that an item was overwritten
+                    false in the case that there was space for the item */
+        bool queue_overwrite( const T& p_item, T* const p_evicted = NULL );
+
+#if FIXEDLENGTHLIST_CXX11
+        /**
+           queue an item onto the end of the list, moving it into place
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool queue( T&& p_item );
+
+        /**
+           As queue_overwrite(), moving the item into place
+
+           \param p_item The item to be added to the list.  Must not refer to
+                         an item in the list
+           \param p_evicted Pointer to be populated with the value of the item
+                            overwritten, if any.  May be NULL
+           \returns true in the case that an item was overwritten
+                    false in the case that there was space for the item */
+        bool queue_overwrite( T&& p_item, T* const p_evicted = NULL );
+
+        /**
+           construct an item in place at the end of the list
+
+           \param p_args Arguments to be passed to T's constructor
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        template < class... Args > bool emplace_back( Args&&... p_args );
+#endif
 
         /**
            dequeue an item from the end of the list (item is removed and
            returned
 
-           \param p_item Pointer to be populated with the value of the item
+           Constant time with FixedLengthListDoubleLinks, otherwise linear in
+           the number of items in the list.
+
+           \param p_item Pointer to be populated with the value of the item.
+                         The item is moved out of the list where supported
            \returns true in the case that an item was returned
                     false in the case that an item was not returned (list empty)
         */
         bool dequeue( T* const p_item );
 
-        bool remove( const T p_item );
+        /**
+           push a number of items onto the front of the list.  The items keep
+           their order, so p_items[0] becomes the new front of the list.  The
+           items are linked in to the list in a single step, rather than one
+           at a time
+
+           \param p_items Array of items to be added to the list
+           \param p_count Number of items in p_items
+           \returns Number of items added, which will be less than p_count in
+                    the case that the list did not have enough space.  Items
+                    which did not fit are those at the end of p_items
+        */
+        size_t push_n( const T* const p_items, const size_t p_count );
+
+        /**
+           queue a number of items onto the end of the list, in the order in
+           which they appear in p_items.  The items are linked in to the list
+           in a single step, rather than one at a time
+
+           \param p_items Array of items to be added to the list
+           \param p_count Number of items in p_items
+           \returns Number of items added, which will be less than p_count in
+                    the case that the list did not have enough space
+        */
+        size_t queue_n( const T* const p_items, const size_t p_count );
+
+        /**
+           pop up to p_max items from the front of the list.  The items are
+           returned in the same order as a series of calls to pop() would
+           return them, but are returned to the free stack in a single step
+
+           \param p_items Array to be populated with the items.  Items are
+                          moved out of the list where supported
+           \param p_max Maximum number of items to pop (size of p_items)
+           \returns Number of items popped
+        */
+        size_t pop_n( T* const p_items, const size_t p_max );
+
+        /**
+           dequeue up to p_max items from the end of the list.  The items are
+           returned in the same order as a series of calls to dequeue() would
+           return them (i.e. p_items[0] is the item which was at the end of
+           the list), but are returned to the free stack in a single step.
+
+           Linear in the number of items dequeued with
+           FixedLengthListDoubleLinks, otherwise linear in the number of items
+           in the list.
+
+           \param p_items Array to be populated with the items.  Items are
+                          moved out of the list where supported
+           \param p_max Maximum number of items to dequeue (size of p_items)
+           \returns Number of items dequeued
+        */
+        size_t dequeue_n( T* const p_items, const size_t p_max );
+
+        /**
+           move up to p_count items from the front of p_other onto the end of
+           this list, keeping their order.
+
+           As each list holds its own items, the items are moved (or, prior
+           to C++11, copied) into this list's free slots.  The run is
+           however linked in to this list, and unlinked from p_other, with a
+           fixed number of link updates rather than one call per item.
+
+           \param p_other List to take the items from.  Splicing a list onto
+                          itself has no effect
+           \param p_count Maximum number of items to move
+           \returns Number of items moved, which will be less than p_count in
+                    the case that p_other does not hold that many items or
+                    this list does not have enough space
+        */
+        size_t splice_back( FixedLengthList& p_other, const size_t p_count );
+
+        /**
+           move as many items as will fit from the front of p_other onto the
+           end of this list, as splice_back( p_other, p_other.used() )
+
+           \param p_other List to take the items from
+           \returns Number of items moved
+        */
+        size_t splice_back( FixedLengthList& p_other );
+
+        /**
+           remove the first item in the list which matches the specified item.
+           In the case that an index is in use and more than one item
+           matches, it is unspecified which of them is removed
+
+           \param p_item Item to be matched against
+           \returns true in the case that an item was removed
+                    false in the case that no matching item was found
+        */
+        bool remove( const T& p_item );
 
         /** Used to find out how many items are in the list
 
@@ -252,55 +682,286 @@ template < class T, size_t queueMax > class FixedLengthList
             \returns true in the case that the item is found in the list
                      false in the case that it is not found in the list
         */
-        bool inList( const T p_val ) const;
+        bool inList( const T& p_val ) const;
 
-        /** Remove the entire contents of the list and return it back to
-            an empty state */
+        /** Remove (and destroy) the entire contents of the list and return it
+            back to an empty state */
         void clear( void );
 
-        typedef FixedLengthListIter<T, queueMax> iterator;
+        /**
+           Re-arrange the items within the list's storage so that their order
+           in memory matches their order in the list, with the free slots
+           grouped after them.  After a long run of insertions and removals
+           the items are scattered through the storage, so iterating over
+           them (or searching with inList()) touches cache lines in a random
+           order; once compacted the list is walked sequentially.
+
+           Linear in the number of slots which have ever been used.  No
+           additional storage is required beyond room for two items on the
+           stack.  The order of the list and its contents are unchanged, but
+           items are moved (copy constructed in C++03), so all iterators are
+           invalidated.  T's copy (or move) constructor must not throw.
+
+           \returns Number of items which were moved
+        */
+        size_t compact( void );
+
+        /** Number of bytes needed to hold a snapshot of the list (see
+            snapshot())
+
+            \returns Size of the snapshot, in bytes */
+        size_t snapshot_size( void ) const;
+
+        /**
+           Write the contents of the list to p_buffer, so that they may later
+           be restored with restore().  The format is a
+           FixedLengthListSnapshotHeader followed by the raw bytes of each item
+           in list order, so T must be trivially copyable.  Items which lie
+           next to each other in storage as well as in the list (as they do in
+           a list which is only queue()d to, or has just been compact()ed) are
+           copied in one go.
+
+           \param p_buffer Buffer to be written to
+           \param p_size Size of p_buffer, in bytes.  See snapshot_size()
+           \returns Number of bytes written, or 0 in the case that p_buffer is
+                    too small
+        */
+        size_t snapshot( void* const p_buffer, const size_t p_size ) const;
+
+        /**
+           As snapshot(), but writing to a stream
+
+           \param p_stream Stream to write to.  Must provide a method
+                           bool write( const void* p_data, size_t p_size ),
+                           as FixedLengthListBufferWriter
+           \returns true in the case that the snapshot was written, false in
+                    the case that a write failed
+        */
+        template < class Stream > bool snapshot( Stream& p_stream ) const;
+
+        /**
+           Replace the contents of the list with those of a snapshot written
+           by snapshot().  The items are copied into the lowest slots in list
+           order (in one go where the storage is contiguous) and then linked,
+           so the list is left compact, as per compact().  Linear in the number
+           of items.
+
+           \param p_buffer Buffer holding the snapshot
+           \param p_size Size of p_buffer, in bytes
+           \returns Number of bytes read, or 0 in the case that p_buffer does
+                    not hold a valid snapshot of a list of T of no more than
+                    queueMax items, in which case the list is left empty
+        */
+        size_t restore( const void* const p_buffer, const size_t p_size );
+
+        /**
+           As restore(), but reading from a stream
+
+           \param p_stream Stream to read from.  Must provide a method
+                           bool read( void* p_data, size_t p_size ),
+                           as FixedLengthListBufferReader
+           \returns true in the case that the snapshot was restored, false in
+                    the case that it was not valid or a read failed, in which
+                    case the list is left empty
+        */
+        template < class Stream > bool restore( Stream& p_stream );
+
+        /** Retrieve the counters recorded by the Stats policy (see
+            FixedLengthListStats.hpp).  All zero with the default policy,
+            FixedLengthListNoStats
+
+            \returns Copy of the counters */
+        FixedLengthListStatsSnapshot stats( void ) const;
+
+        /** Reset the counters recorded by the Stats policy to zero */
+        void reset_stats( void );
+
+        typedef FixedLengthListIter<T, queueMax, Links> iterator;
+        typedef FixedLengthListIter<T, queueMax, Links, const T> const_iterator;
         typedef T value_type;
         typedef T * pointer;
         typedef T & reference;
+        typedef const T * const_pointer;
+        typedef const T & const_reference;
+        typedef ptrdiff_t difference_type;
+        typedef size_t size_type;
 
         iterator begin( void );
         iterator end( void );
+        const_iterator begin( void ) const;
+        const_iterator end( void ) const;
+        const_iterator cbegin( void ) const;
+        const_iterator cend( void ) const;
+
+        /**
+           Remove (and destroy) the item referred to by an iterator.  Constant
+           time: with backward links the neighbouring items are found directly,
+           otherwise the iterator's record of the preceding item is used.
+           This is kept up to date as the iterator is incremented, so it is
+           only in the case that the preceding item has since been removed,
+           or the iterator was not reached by stepping forward from begin(),
+           that the list is walked to find it.
+
+           Iterators referring to the removed item are invalidated, others
+           are not.
+
+           Example, removing all odd items in a single pass:
+           \code
+                  for( list_t::iterator it = list.begin(); it != list.end(); )
+                  {
+                      if( *it & 1 ) {
+                          it = list.erase( it );
+                      } else {
+                          ++it;
+                      }
+                  }
+           \endcode
+
+           \param p_pos Iterator referring to the item to be removed.  Must
+                        not be end()
+           \returns Iterator referring to the item which followed the removed
+                    item, or end() in the case that it was the last
+        */
+        iterator erase( const iterator p_pos );
+
+        /**
+           Copy an item into the list immediately after the item referred to
+           by an iterator.  Constant time
+
+           \param p_pos Iterator referring to the item to insert after.  In the
+                        case that this is end() the item is added to the end
+                        of the list, as per queue()
+           \param p_item Item to be added
+           \returns Iterator referring to the new item, or end() in the case
+                    that the list was full
+        */
+        iterator insert_after( const iterator p_pos, const T& p_item );
+
+#if FIXEDLENGTHLIST_CXX11
+        /**
+           Move an item into the list immediately after the item referred to
+           by an iterator.  Constant time
+
+           \param p_pos Iterator referring to the item to insert after.  In the
+                        case that this is end() the item is added to the end
+                        of the list, as per queue()
+           \param p_item Item to be added
+           \returns Iterator referring to the new item, or end() in the case
+                    that the list was full
+        */
+        iterator insert_after( const iterator p_pos, T&& p_item );
+#endif
 };
 
 
-template < class T, size_t queueMax > 
-FixedLengthList< T, queueMax >::FixedLengthList( void )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FIXEDLENGTHLIST_CONSTEXPR FixedLengthList< T, queueMax, Links, Index, Stats >::FixedLengthList( void )
+    : m_items(),
+      m_freeHead( links_t::nil() ),
+      m_usedHead( links_t::nil() ),
+      m_usedTail( links_t::nil() ),
+      m_usedCount( 0U ),
+      m_highWater( 0U )
+{
+    /* As reset(), but in a form which may be evaluated at compile time */
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthList< T, queueMax, Links, Index, Stats >::FixedLengthList( const FixedLengthList& p_other )
+{
+    reset();
+
+    for( link_t p = p_other.m_usedHead;
+         p != links_t::nil();
+         p = p_other.m_items.next( p ) )
+    {
+        queue( p_other.m_items.item( p ) );
+    }
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthList< T, queueMax, Links, Index, Stats >::~FixedLengthList( void )
+{
+    destroy_items();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthList< T, queueMax, Links, Index, Stats >& FixedLengthList< T, queueMax, Links, Index, Stats >::operator=( const FixedLengthList& p_other )
+{
+    if( this != &p_other )
+    {
+        clear();
+
+        for( link_t p = p_other.m_usedHead;
+             p != links_t::nil();
+             p = p_other.m_items.next( p ) )
+        {
+            queue( p_other.m_items.item( p ) );
+        }
+    }
+
+    return *this;
+}
+
+#if FIXEDLENGTHLIST_CXX11
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthList< T, queueMax, Links, Index, Stats >::FixedLengthList( FixedLengthList&& p_other )
+{
+    reset();
+
+    /* Moves the items across, taking each out of p_other's index before
+       it's moved from */
+    splice_back( p_other );
+
+    p_other.clear();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthList< T, queueMax, Links, Index, Stats >& FixedLengthList< T, queueMax, Links, Index, Stats >::operator=( FixedLengthList&& p_other )
 {
-    clear();
+    if( this != &p_other )
+    {
+        clear();
+
+        splice_back( p_other );
+
+        p_other.clear();
+    }
+
+    return *this;
 }
+#endif
  
-template < class T, size_t queueMax > 
-FixedLengthList< T, queueMax >::FixedLengthList( const T* const p_items, size_t p_count ) 
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthList< T, queueMax, Links, Index, Stats >::FixedLengthList( const T* const p_items, size_t p_count )
 {
 
     const T* src = p_items;
 
     /* Can only populate up to queueMax items */
     size_t init_count = std::min( queueMax, p_count );
-    FixedLengthListItem<T>* prev = NULL;
+    link_t prev = links_t::nil();
 
-    m_usedHead = NULL;
-    m_usedTail = NULL;
+    m_usedHead = links_t::nil();
+    m_usedTail = links_t::nil();
 
-    /* Initialise the list from p_items, building the forward links */
+    /* Initialise the list from p_items, building the forward (and, if in use,
+       backward) links */
     for( size_t i = 0;
          i < init_count;
          i++ )
     {
-        FixedLengthListItem<T>* current = &(m_items[i]);
+        link_t current = m_items.slot( i );
 
-        current->m_forward = NULL;
-        current->m_item = *(src++);
+        m_items.set_next( current, links_t::nil() );
+        m_items.set_prev( current, prev );
+        ::new( static_cast<void*>( &( m_items.item( current ) ) ) ) T( *(src++) );
+        this->index_insert( m_items, current );
 
         /* If there was a previous item in the list, set up its forward pointer,
            otherwise set up the list head */
-        if( prev != NULL ) {
-            prev->m_forward = current;
+        if( prev != links_t::nil() ) {
+            m_items.set_next( prev, current );
         } else {
             m_usedHead = current;
         }
@@ -312,366 +973,1395 @@ FixedLengthList< T, queueMax >::FixedLengthList( const T* const p_items, size_t
 
     m_usedCount = init_count;
 
-    m_freeHead = NULL;
+    /* Any remaining items are above the high water mark, so will be taken
+       as needed */
+    m_freeHead = links_t::nil();
+    m_highWater = init_count;
 
-    /* Any remaining items get moved into the free stack */
-    
-    prev = NULL;
-    for( size_t i = init_count;
-         i < queueMax;
-         i++ )
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, p_count - init_count, m_usedCount );
+}
+
+#if FIXEDLENGTHLIST_CXX14
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+template < size_t count >
+constexpr FixedLengthList< T, queueMax, Links, Index, Stats >::FixedLengthList( const T ( &p_items )[ count ] )
+    : m_items( p_items, std::make_index_sequence< count >() ),
+      m_freeHead( links_t::nil() ),
+      m_usedHead( m_items.slot( 0U ) ),
+      m_usedTail( m_items.slot( count - 1U ) ),
+      m_usedCount( count ),
+      m_highWater( count )
+{
+    static_assert( count <= queueMax, "Too many items to initialise the list with" );
+
+    /* Constant conditions - neither branch is taken with the default
+       policies, so this remains a constant expression */
+    if( index_t::enabled )
     {
-        FixedLengthListItem<T>* current = &(m_items[i]);
-        current->m_forward = NULL;
-        if( prev != NULL ) {
-            prev->m_forward = current;
-        } else {
-            m_freeHead = current;
+        for( size_t i = 0;
+             i < count;
+             i++ )
+        {
+            this->index_insert( m_items, m_items.slot( i ) );
         }
-        prev = current;
+    }
+
+    if( Stats::enabled )
+    {
+        this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, 0U, count );
     }
 }
+#endif
 
-template < class T, size_t queueMax > 
-void FixedLengthList< T, queueMax >::clear( void )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::clear( void )
 {
-    FixedLengthListItem<T>* p;
-    size_t i;
+    this->stats_op( FixedLengthListStatsSnapshot::OP_CLEAR );
 
-    m_usedHead = NULL;
-    m_usedTail = NULL;
-    m_freeHead = m_items;
-    
-    /* Move all items into the free stack, setting up the forward links */
-    for( p = m_items, i = (queueMax-1);
-         i > 0 ;
-         i-- )
+    destroy_items();
+    reset();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::relocate( T& p_dst, T& p_src )
+{
+#if FIXEDLENGTHLIST_CXX11
+    ::new( static_cast<void*>( &p_dst ) ) T( std::move( p_src ) );
+#else
+    ::new( static_cast<void*>( &p_dst ) ) T( p_src );
+#endif
+    p_src.~T();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::destroy_items( void )
+{
+    /* Constant condition - the loop is dropped for types with no
+       destructor, unless there's an index to maintain */
+    if( index_t::enabled || !FIXEDLENGTHLIST_TRIVIALLY_DESTRUCTIBLE( T ) )
     {
-        FixedLengthListItem<T>* next = p+1;
-        p->m_forward = next;
-        p = next;
+        for( link_t p = m_usedHead;
+             p != links_t::nil();
+             p = m_items.next( p ) )
+        {
+            this->index_erase( m_items, p );
+            m_items.item( p ).~T();
+        }
     }
-    p->m_forward = NULL;
-    m_usedCount = 0U;
 }
 
-template < class T, size_t queueMax > 
-bool FixedLengthList< T, queueMax >::push( const T p_item )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::reset( void )
 {
-    bool ret_val = false;
+    m_usedHead = links_t::nil();
+    m_usedTail = links_t::nil();
     
-    /* Check that there's space in the list */
-    if( m_freeHead != NULL )
-    {
-        FixedLengthListItem<T>* new_item = m_freeHead;
+    /* No need to visit each of the items - all of them are above the high
+       water mark, so will be taken as needed */
+    m_freeHead = links_t::nil();
+    m_highWater = 0U;
+    m_usedCount = 0U;
+}
 
-        /* Move the head pointer to the next free item in the list */
-        m_freeHead = new_item->m_forward;
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+typename FixedLengthList< T, queueMax, Links, Index, Stats >::link_t FixedLengthList< T, queueMax, Links, Index, Stats >::free_head( void )
+{
+    /* Prefer items from the free stack, as they have been used recently so
+       are more likely to be in the cache */
+    if( ( m_freeHead == links_t::nil() ) && ( m_highWater < queueMax ) )
+    {
+        m_freeHead = m_items.slot( m_highWater++ );
+        m_items.set_next( m_freeHead, links_t::nil() );
+    }
 
-        new_item->m_forward = m_usedHead;
+    return m_freeHead;
+}
 
-        new_item->m_item = p_item;
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_front( void )
+{
+    link_t new_item = m_freeHead;
 
-        m_usedHead = new_item;
+    this->index_insert( m_items, new_item );
 
-        if( m_usedTail == NULL )
-        {
-            m_usedTail = new_item;
-        }
+    /* Move the head pointer to the next free item in the list */
+    m_freeHead = m_items.next( new_item );
 
-        m_usedCount++;
+    m_items.set_next( new_item, m_usedHead );
+    m_items.set_prev( new_item, links_t::nil() );
 
-        /* Indicate success */
-        ret_val = true;
+    /* Update the current head item, if exists, otherwise this is the only
+       item so is also the tail */
+    if( m_usedHead != links_t::nil() )
+    {
+        m_items.set_prev( m_usedHead, new_item );
+    }
+    else
+    {
+        m_usedTail = new_item;
     }
 
-    return ret_val;
+    m_usedHead = new_item;
+
+    m_usedCount++;
 }
 
-template < class T, size_t queueMax > 
-bool FixedLengthList< T, queueMax >::queue( const T p_item )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_back( void )
 {
-    bool ret_val = false;
-    
-    /* Check that there's space in the list */
-    if( m_freeHead != NULL )
+    /* Grab a free item */
+    link_t new_item = m_freeHead;
+
+    this->index_insert( m_items, new_item );
+
+    /* Move the head pointer to the next free item in the list */
+    m_freeHead = m_items.next( m_freeHead );
+
+    /* Item is going at end of list - no forward link */
+    m_items.set_next( new_item, links_t::nil() );
+    m_items.set_prev( new_item, m_usedTail );
+
+    /* Update the current tail item, if exists */
+    if( m_usedTail != links_t::nil() )
     {
-        /* Grab a free item */
-        FixedLengthListItem<T>* new_item = m_freeHead;
+        m_items.set_next( m_usedTail, new_item );
+    }
 
-        /* Move the head pointer to the next free item in the list */
-        m_freeHead = m_freeHead->m_forward;
+    m_usedTail = new_item;
 
-        /* Item is going at end of list - no forward link */
-        new_item->m_forward = NULL;
+    if( m_usedHead == links_t::nil() )
+    {
+        m_usedHead = new_item;
+    }
 
-        new_item->m_item = p_item;
+    m_usedCount++;
+}
 
-        /* Update the current tail item, if exists */
-        if( m_usedTail != NULL )
-        {
-            m_usedTail->m_forward = new_item;
-        }
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_after( const link_t p_pos )
+{
+    link_t new_item = m_freeHead;
+    link_t next = m_items.next( p_pos );
 
-        m_usedTail = new_item;
+    this->index_insert( m_items, new_item );
 
-        if( m_usedHead == NULL )
-        {
-            m_usedHead = new_item;
-        }
+    /* Move the head pointer to the next free item in the list */
+    m_freeHead = m_items.next( new_item );
 
-        m_usedCount++;
+    m_items.set_next( new_item, next );
+    m_items.set_prev( new_item, p_pos );
+    m_items.set_next( p_pos, new_item );
 
-        /* Indicate success */
-        ret_val = true;
+    /* Update the following item, if exists, otherwise the new item is the
+       tail */
+    if( next != links_t::nil() )
+    {
+        m_items.set_prev( next, new_item );
+    }
+    else
+    {
+        m_usedTail = new_item;
     }
 
-    return ret_val;
+    m_usedCount++;
 }
 
-template < class T, size_t queueMax > 
-bool FixedLengthList< T, queueMax >::pop( T* const p_item )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::push( const T& p_item )
 {
     bool ret_val = false;
     
-    if( m_usedHead != NULL )
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
     {
-        FixedLengthListItem<T>* old_item = m_usedHead;
-
-        *p_item = old_item->m_item;
-
-        m_usedHead = old_item->m_forward;
-        
-        if( m_usedTail == old_item )
-        {
-            m_usedTail = NULL;
-        }
-
-        old_item->m_forward = m_freeHead;
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( p_item );
 
-        m_freeHead = old_item;
-
-        m_usedCount--;
+        link_front();
 
         /* Indicate success */
         ret_val = true;
     }
 
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_PUSH, ret_val ? 0U : 1U, m_usedCount );
+
     return ret_val;
 }
 
-template < class T, size_t queueMax >
-bool FixedLengthList< T, queueMax >::dequeue( T* const p_item )
+#if FIXEDLENGTHLIST_CXX11
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::push( T&& p_item )
 {
     bool ret_val = false;
 
-    if( m_usedTail != NULL )
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
     {
-        FixedLengthListItem<T>* old_item = m_usedTail;
-
-        *p_item = old_item->m_item;
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( std::move( p_item ) );
 
-        remove_node( old_item );
+        link_front();
 
         /* Indicate success */
         ret_val = true;
     }
 
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_PUSH, ret_val ? 0U : 1U, m_usedCount );
+
     return ret_val;
 }
-        
 
-template < class T, size_t queueMax >
-void FixedLengthList< T, queueMax >::remove_node( FixedLengthListItem<T>* p_item )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+template < class... Args >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::emplace_front( Args&&... p_args )
 {
-    /* Item removed was only item in the list? */
-    if( m_usedHead == p_item )
+    bool ret_val = false;
+    
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
     {
-        m_usedHead = NULL;
-        m_usedTail = NULL;
-    } else {
-        FixedLengthListItem<T>* p = m_usedHead;
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( std::forward< Args >( p_args )... );
 
-        /* Need to update the forward pointer of the
-           item preceding the one which we've just removed.
-           That item also becomes the new tail
+        link_front();
 
-           Iterate the list and find it */
-        while( p != NULL )
-        {
-            if( p->m_forward == p_item )
-            {
-                p->m_forward = NULL;
-                m_usedTail = p;
-                break;
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_PUSH, ret_val ? 0U : 1U, m_usedCount );
+
+    return ret_val;
+}
+#endif
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::queue( const T& p_item )
+{
+    bool ret_val = false;
+    
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
+    {
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( p_item );
+
+        link_back();
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, ret_val ? 0U : 1U, m_usedCount );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::queue_overwrite( const T& p_item, T* const p_evicted )
+{
+    bool ret_val = make_space( p_evicted );
+
+    queue( p_item );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::make_space( T* const p_evicted )
+{
+    bool ret_val = false;
+
+    /* No space - take the item at the front of the list, returning its node
+       to the free stack where queue() will pick it up again */
+    if( free_head() == links_t::nil() )
+    {
+        remove_node( m_usedHead, links_t::nil(), p_evicted );
+
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+#if FIXEDLENGTHLIST_CXX11
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::queue( T&& p_item )
+{
+    bool ret_val = false;
+    
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
+    {
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( std::move( p_item ) );
+
+        link_back();
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, ret_val ? 0U : 1U, m_usedCount );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::queue_overwrite( T&& p_item, T* const p_evicted )
+{
+    bool ret_val = make_space( p_evicted );
+
+    queue( std::move( p_item ) );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+template < class... Args >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::emplace_back( Args&&... p_args )
+{
+    bool ret_val = false;
+    
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
+    {
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( std::forward< Args >( p_args )... );
+
+        link_back();
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, ret_val ? 0U : 1U, m_usedCount );
+
+    return ret_val;
+}
+#endif
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::pop( T* const p_item )
+{
+    bool ret_val = false;
+    
+    if( m_usedHead != links_t::nil() )
+    {
+        remove_node( m_usedHead, links_t::nil(), p_item );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    this->stats_op( FixedLengthListStatsSnapshot::OP_POP );
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::dequeue( T* const p_item )
+{
+    bool ret_val = false;
+
+    if( m_usedTail != links_t::nil() )
+    {
+        remove_node( m_usedTail, prev_node( m_usedTail ), p_item );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    this->stats_op( FixedLengthListStatsSnapshot::OP_DEQUEUE );
+
+    return ret_val;
+}
+        
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+typename FixedLengthList< T, queueMax, Links, Index, Stats >::link_t FixedLengthList< T, queueMax, Links, Index, Stats >::construct_run( const T* const p_items, const size_t p_count )
+{
+    link_t last = links_t::nil();
+
+    for( size_t i = 0;
+         i < p_count;
+         i++ )
+    {
+        link_t p = free_head();
+
+        ::new( static_cast<void*>( &( m_items.item( p ) ) ) ) T( p_items[ i ] );
+        this->index_insert( m_items, p );
+        m_freeHead = m_items.next( p );
+
+        /* The free stack may run out part way through, with the remainder
+           coming from above the high water mark, so link the run up as it
+           is built */
+        m_items.set_prev( p, last );
+        if( last != links_t::nil() )
+        {
+            m_items.set_next( last, p );
+        }
+        last = p;
+    }
+
+    m_items.set_next( last, links_t::nil() );
+
+    return last;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_run_front( const link_t p_first, const link_t p_last, const size_t p_count )
+{
+    m_items.set_next( p_last, m_usedHead );
+
+    if( m_usedHead != links_t::nil() )
+    {
+        m_items.set_prev( m_usedHead, p_last );
+    }
+    else
+    {
+        m_usedTail = p_last;
+    }
+
+    m_usedHead = p_first;
+    m_usedCount += p_count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_run_back( const link_t p_first, const link_t p_last, const size_t p_count )
+{
+    m_items.set_prev( p_first, m_usedTail );
+
+    if( m_usedTail != links_t::nil() )
+    {
+        m_items.set_next( m_usedTail, p_first );
+    }
+    else
+    {
+        m_usedHead = p_first;
+    }
+
+    m_usedTail = p_last;
+    m_usedCount += p_count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::free_run( const link_t p_before, const link_t p_last, const size_t p_count )
+{
+    link_t first = ( p_before == links_t::nil() ) ? m_usedHead : m_items.next( p_before );
+    link_t after = m_items.next( p_last );
+
+    /* Constant condition - the loop is dropped for types with no
+       destructor */
+    if( !FIXEDLENGTHLIST_TRIVIALLY_DESTRUCTIBLE( T ) )
+    {
+        for( link_t p = first;
+             p != after;
+             p = m_items.next( p ) )
+        {
+            m_items.item( p ).~T();
+        }
+    }
+
+    /* Close the gap in the used list */
+    if( p_before == links_t::nil() )
+    {
+        m_usedHead = after;
+    }
+    else
+    {
+        m_items.set_next( p_before, after );
+    }
+
+    if( after == links_t::nil() )
+    {
+        m_usedTail = p_before;
+    }
+    else
+    {
+        m_items.set_prev( after, p_before );
+    }
+
+    /* The run is still forward linked, so can go onto the free stack
+       as-is */
+    m_items.set_next( p_last, m_freeHead );
+    m_freeHead = first;
+
+    m_usedCount -= p_count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::push_n( const T* const p_items, const size_t p_count )
+{
+    size_t count = std::min( p_count, available() );
+
+    if( count > 0U )
+    {
+        link_t first = free_head();
+        link_t last = construct_run( p_items, count );
+
+        link_run_front( first, last, count );
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_PUSH, p_count - count, m_usedCount );
+
+    return count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::queue_n( const T* const p_items, const size_t p_count )
+{
+    size_t count = std::min( p_count, available() );
+
+    if( count > 0U )
+    {
+        link_t first = free_head();
+        link_t last = construct_run( p_items, count );
+
+        link_run_back( first, last, count );
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, p_count - count, m_usedCount );
+
+    return count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::pop_n( T* const p_items, const size_t p_max )
+{
+    size_t count = std::min( p_max, m_usedCount );
+
+    if( count > 0U )
+    {
+        link_t last = links_t::nil();
+        link_t p = m_usedHead;
+
+        for( size_t i = 0;
+             i < count;
+             i++ )
+        {
+            this->index_erase( m_items, p );
+            p_items[ i ] = FIXEDLENGTHLIST_MOVE( m_items.item( p ) );
+            last = p;
+            p = m_items.next( p );
+        }
+
+        free_run( links_t::nil(), last, count );
+    }
+
+    this->stats_op( FixedLengthListStatsSnapshot::OP_POP );
+
+    return count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::dequeue_n( T* const p_items, const size_t p_max )
+{
+    size_t count = std::min( p_max, m_usedCount );
+
+    if( count > 0U )
+    {
+        link_t before = links_t::nil();
+
+        /* Find the item preceding the run to be dequeued */
+        if( links_t::doubly_linked )
+        {
+            before = m_usedTail;
+            for( size_t i = 0;
+                 i < count;
+                 i++ )
+            {
+                before = m_items.prev( before );
             }
-            else
+        }
+        else if( count < m_usedCount )
+        {
+            before = m_usedHead;
+            for( size_t i = 1;
+                 i < ( m_usedCount - count );
+                 i++ )
+            {
+                before = m_items.next( before );
+            }
+
+            this->stats_scan( m_usedCount - count );
+        }
+
+        /* Walk the run forwards, filling p_items from the end so that the
+           last item in the list comes out first */
+        link_t p = ( before == links_t::nil() ) ? m_usedHead : m_items.next( before );
+        for( size_t i = count;
+             i > 0U;
+             i-- )
+        {
+            this->index_erase( m_items, p );
+            p_items[ i - 1U ] = FIXEDLENGTHLIST_MOVE( m_items.item( p ) );
+            p = m_items.next( p );
+        }
+
+        free_run( before, m_usedTail, count );
+    }
+
+    this->stats_op( FixedLengthListStatsSnapshot::OP_DEQUEUE );
+
+    return count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::splice_back( FixedLengthList& p_other, const size_t p_count )
+{
+    size_t count = 0U;
+
+    if( &p_other != this )
+    {
+        count = std::min( std::min( p_count, p_other.m_usedCount ), available() );
+    }
+
+    if( count > 0U )
+    {
+        link_t first = free_head();
+        link_t last = links_t::nil();
+        link_t src = p_other.m_usedHead;
+        link_t src_last = links_t::nil();
+
+        /* Build the run in this list's free slots, as construct_run() */
+        for( size_t i = 0;
+             i < count;
+             i++ )
+        {
+            link_t p = free_head();
+
+            p_other.index_erase( p_other.m_items, src );
+            ::new( static_cast<void*>( &( m_items.item( p ) ) ) ) T( FIXEDLENGTHLIST_MOVE( p_other.m_items.item( src ) ) );
+            this->index_insert( m_items, p );
+            m_freeHead = m_items.next( p );
+
+            m_items.set_prev( p, last );
+            if( last != links_t::nil() )
             {
-                p = p->m_forward;
+                m_items.set_next( last, p );
             }
+            last = p;
+            src_last = src;
+            src = p_other.m_items.next( src );
+        }
+
+        m_items.set_next( last, links_t::nil() );
+
+        link_run_back( first, last, count );
+        p_other.free_run( links_t::nil(), src_last, count );
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_SPLICE, 0U, m_usedCount );
+
+    return count;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::splice_back( FixedLengthList& p_other )
+{
+    return splice_back( p_other, p_other.m_usedCount );
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+typename FixedLengthList< T, queueMax, Links, Index, Stats >::link_t FixedLengthList< T, queueMax, Links, Index, Stats >::prev_node( const link_t p_item ) const
+{
+    link_t ret_val = links_t::nil();
+
+    if( links_t::doubly_linked )
+    {
+        ret_val = m_items.prev( p_item );
+    }
+    else if( m_usedHead != p_item )
+    {
+        link_t p = m_usedHead;
+        size_t nodes = 1U;
+
+        /* No backward links, so iterate the list and find the item which
+           has p_item as its forward link */
+        while( m_items.next( p ) != p_item )
+        {
+            p = m_items.next( p );
+            nodes++;
         }
+
+        this->stats_scan( nodes );
+
+        ret_val = p;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::remove_node( const link_t p_item, const link_t p_prev, T* const p_out )
+{
+    link_t next = m_items.next( p_item );
+
+    /* Take the item out of the index before it's moved from, as the index
+       finds it by its value */
+    this->index_erase( m_items, p_item );
+
+    if( p_out != NULL )
+    {
+        *p_out = FIXEDLENGTHLIST_MOVE( m_items.item( p_item ) );
+    }
+
+    /* If there was no previous item then this must be the head, so update
+       the head pointer, otherwise update the forward pointer on the
+       preceding item in the list */
+    if( p_prev == links_t::nil() )
+    {
+        m_usedHead = next;
+    }
+    else
+    {
+        m_items.set_next( p_prev, next );
+    }
+
+    /* Likewise, if there's no next item this must be the tail, otherwise
+       update the backward pointer on the following item in the list */
+    if( next == links_t::nil() )
+    {
+        m_usedTail = p_prev;
+    }
+    else
+    {
+        m_items.set_prev( next, p_prev );
     }
 
-    /* Move item to free list */
-    p_item->m_forward = m_freeHead;
+    /* Item is no longer in use - destroy it and move it to the free list */
+    m_items.item( p_item ).~T();
+    m_items.set_next( p_item, m_freeHead );
     m_freeHead = p_item;
 
     m_usedCount--;
 }
 
-template < class T, size_t queueMax >
-bool FixedLengthList< T, queueMax >::remove( const T p_item )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::remove( const T& p_item )
 {
     bool ret_val = false;
-    FixedLengthListItem<T>* last = NULL;
-    FixedLengthListItem<T>* p = m_usedHead;
+    link_t last = links_t::nil();
+    link_t p = m_usedHead;
+    size_t nodes = 0U;
 
-    /* Run through all the items in the used list */
-    while( p != NULL )
+    this->stats_op( FixedLengthListStatsSnapshot::OP_REMOVE );
+
+    if( index_t::enabled )
+    {
+        p = this->index_find( m_items, p_item );
+
+        if( p != links_t::nil() )
+        {
+            remove_node( p, prev_node( p ) );
+
+            ret_val = true;
+        }
+    }
+    else
     {
-        /* Does the item match the one we're looking for? */
-        if( p->m_item == p_item )
+        /* Run through all the items in the used list */
+        while( p != links_t::nil() )
         {
-            /* If there was no last item then this must be the head, so update
-               the head pointer, otherwise update the forward pointer on the
-               prevceding item in the list */
-            if( last == NULL )
+            nodes++;
+
+            /* Does the item match the one we're looking for? */
+            if( m_items.item( p ) == p_item )
             {
-                m_usedHead = p->m_forward;
+                remove_node( p, last );
+
+                ret_val = true;
+                break;
             }
             else
             {
-                last->m_forward = p->m_forward;
+                last = p;
+                p = m_items.next( p );
             }
+        }
 
-            /* Is this item the tail?  If so, update! */
-            if( m_usedTail == p )
+        this->stats_scan( nodes );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::used() const
+{
+    return m_usedCount;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::available() const
+{
+    return queueMax - m_usedCount;
+}
+        
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::inList( const T& p_val ) const
+{
+    bool ret_val = false;
+    link_t p = m_usedHead;
+    size_t nodes = 0U;
+
+    this->stats_op( FixedLengthListStatsSnapshot::OP_SEARCH );
+
+    if( index_t::enabled )
+    {
+        ret_val = ( this->index_find( m_items, p_val ) != links_t::nil() );
+    }
+    else
+    {
+        /* Ordered iteration of the list checking for specified item */
+        while( p != links_t::nil() )
+        {
+            nodes++;
+
+            if( m_items.item( p ) == p_val ) {
+                /* Item found - flag and break out */
+                ret_val = true;
+                break;
+            } else {
+                p = m_items.next( p );
+            }
+        }
+
+        this->stats_scan( nodes );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::compact( void )
+{
+    size_t ret_val = 0U;
+    size_t i = 0U;
+    FixedLengthListSlot< T > buffers[ 2 ];
+    T* carry = &( buffers[ 0 ].value() );
+    T* spare = &( buffers[ 1 ].value() );
+
+    /* Constant condition - the index refers to items by their slot, so is
+       emptied here and re-built once the items are in their new slots */
+    if( index_t::enabled )
+    {
+        for( link_t p = m_usedHead;
+             p != links_t::nil();
+             p = m_items.next( p ) )
+        {
+            this->index_erase( m_items, p );
+        }
+    }
+
+    /* The forward links are used to record where each item is to go.
+       Free items below the high water mark are marked with a nil link ... */
+    for( link_t p = m_freeHead;
+         p != links_t::nil(); )
+    {
+        link_t next = m_items.next( p );
+        m_items.set_next( p, links_t::nil() );
+        p = next;
+    }
+
+    /* ... and the nth item in the list with a link to the nth slot */
+    for( link_t p = m_usedHead;
+         p != links_t::nil();
+         i++ )
+    {
+        link_t next = m_items.next( p );
+        m_items.set_next( p, m_items.slot( i ) );
+        p = next;
+    }
+
+    /* Follow each chain of items which are out of place, starting with the
+       lowest.  Items which are in place are marked with a link to
+       themselves.  Each chain ends either at a free slot, or back at the
+       start, which is freed as its item is taken */
+    for( i = 0U;
+         i < m_highWater;
+         i++ )
+    {
+        link_t p = m_items.slot( i );
+        link_t dest = m_items.next( p );
+
+        if( ( dest != links_t::nil() ) && ( dest != p ) )
+        {
+            relocate( *carry, m_items.item( p ) );
+            m_items.set_next( p, links_t::nil() );
+
+            for( link_t next = m_items.next( dest );
+                 next != links_t::nil();
+                 next = m_items.next( dest ) )
             {
-                m_usedTail = last;
+                T* const taken = spare;
+
+                relocate( *spare, m_items.item( dest ) );
+                relocate( m_items.item( dest ), *carry );
+                m_items.set_next( dest, dest );
+                ret_val++;
+
+                spare = carry;
+                carry = taken;
+                dest = next;
             }
- 
-            /* Move item to free list */
-            p->m_forward = m_freeHead;
-            m_freeHead = p;
 
-            m_usedCount--;
+            relocate( m_items.item( dest ), *carry );
+            m_items.set_next( dest, dest );
+            ret_val++;
+        }
+    }
 
-            ret_val = true;
-            break;
+    /* Re-build the links.  All slots above the used items are now free, so
+       are returned above the high water mark */
+    link_in_order();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_in_order( void )
+{
+    for( size_t i = 0U;
+         i < m_usedCount;
+         i++ )
+    {
+        link_slot( i );
+    }
+
+    link_ends();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_slot( const size_t p_index )
+{
+    link_t p = m_items.slot( p_index );
+
+    m_items.set_next( p, ( ( p_index + 1U ) < m_usedCount ) ? m_items.slot( p_index + 1U ) : links_t::nil() );
+    m_items.set_prev( p, ( p_index > 0U ) ? m_items.slot( p_index - 1U ) : links_t::nil() );
+    this->index_insert( m_items, p );
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::link_ends( void )
+{
+    m_usedHead = ( m_usedCount > 0U ) ? m_items.slot( 0U ) : links_t::nil();
+    m_usedTail = ( m_usedCount > 0U ) ? m_items.slot( m_usedCount - 1U ) : links_t::nil();
+    m_freeHead = links_t::nil();
+    m_highWater = m_usedCount;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::snapshot_size( void ) const
+{
+    return sizeof( FixedLengthListSnapshotHeader ) + ( m_usedCount * sizeof( T ) );
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::snapshot( void* const p_buffer, const size_t p_size ) const
+{
+    FixedLengthListBufferWriter writer( p_buffer, p_size );
+
+    return snapshot( writer ) ? writer.used() : 0U;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+template < class Stream >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::snapshot( Stream& p_stream ) const
+{
+#if FIXEDLENGTHLIST_CXX11
+    static_assert( std::is_trivially_copyable<T>::value, "T must be trivially copyable to be snapshot" );
+#endif
+
+    FixedLengthListSnapshotHeader header;
+    header.m_magic = FixedLengthListSnapshotHeader::MAGIC;
+    header.m_version = FixedLengthListSnapshotHeader::VERSION;
+    header.m_headerSize = sizeof( FixedLengthListSnapshotHeader );
+    header.m_itemSize = sizeof( T );
+    header.m_count = (uint32_t)m_usedCount;
+
+    bool ret_val = p_stream.write( &header, sizeof( header ) );
+
+    for( link_t p = m_usedHead;
+         ret_val && ( p != links_t::nil() ); )
+    {
+        link_t first = p;
+        size_t run = 1U;
+        link_t next = m_items.next( p );
+
+        /* Constant condition - gather the items which follow on in storage
+           as well as in the list, to be written in one go */
+        if( links_t::contiguous )
+        {
+            while( ( next != links_t::nil() ) && ( m_items.index( next ) == ( m_items.index( p ) + 1U ) ) )
+            {
+                p = next;
+                next = m_items.next( p );
+                run++;
+            }
+        }
+
+        ret_val = p_stream.write( &( m_items.item( first ) ), run * sizeof( T ) );
+        p = next;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+size_t FixedLengthList< T, queueMax, Links, Index, Stats >::restore( const void* const p_buffer, const size_t p_size )
+{
+    FixedLengthListBufferReader reader( p_buffer, p_size );
+
+    return restore( reader ) ? reader.used() : 0U;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+template < class Stream >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::restore( Stream& p_stream )
+{
+#if FIXEDLENGTHLIST_CXX11
+    static_assert( std::is_trivially_copyable<T>::value, "T must be trivially copyable to be restored" );
+#endif
+
+    FixedLengthListSnapshotHeader header;
+    bool ret_val;
+
+    destroy_items();
+    reset();
+
+    ret_val = p_stream.read( &header, sizeof( header ) ) &&
+              ( header.m_magic == FixedLengthListSnapshotHeader::MAGIC ) &&
+              ( header.m_version == FixedLengthListSnapshotHeader::VERSION ) &&
+              ( header.m_headerSize >= sizeof( header ) ) &&
+              ( header.m_itemSize == sizeof( T ) ) &&
+              ( header.m_count <= queueMax ) &&
+              skip( p_stream, header.m_headerSize - sizeof( header ) );
+
+    if( ret_val )
+    {
+        m_usedCount = header.m_count;
+
+        /* Constant condition - read the items straight into their slots, in
+           one go where the slots are contiguous.  Otherwise each slot is
+           linked as it is read, so that it's only visited once */
+        if( links_t::contiguous )
+        {
+            ret_val = ( m_usedCount == 0U ) ||
+                      p_stream.read( &( m_items.item( m_items.slot( 0U ) ) ), m_usedCount * sizeof( T ) );
+            if( ret_val )
+            {
+                link_in_order();
+            }
         }
         else
         {
-            last = p;
-            p = p->m_forward;
+            size_t i = 0U;
+
+            while( ret_val && ( i < m_usedCount ) )
+            {
+                ret_val = p_stream.read( &( m_items.item( m_items.slot( i ) ) ), sizeof( T ) );
+                if( ret_val )
+                {
+                    link_slot( i++ );
+                }
+            }
+
+            /* Trim the list to the items read, so that it can be dropped
+               below */
+            if( !ret_val )
+            {
+                m_usedCount = i;
+                if( i > 0U )
+                {
+                    m_items.set_next( m_items.slot( i - 1U ), links_t::nil() );
+                }
+            }
+            link_ends();
         }
     }
 
+    if( ret_val )
+    {
+        this->stats_insert( FixedLengthListStatsSnapshot::OP_QUEUE, 0U, m_usedCount );
+    }
+    else
+    {
+        /* Drop anything partly restored */
+        destroy_items();
+        reset();
+    }
+
     return ret_val;
 }
 
-template < class T, size_t queueMax > 
-size_t FixedLengthList< T, queueMax >::used() const
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+template < class Stream >
+bool FixedLengthList< T, queueMax, Links, Index, Stats >::skip( Stream& p_stream, size_t p_size )
 {
-    return m_usedCount;
+    bool ret_val = true;
+    unsigned char scratch[ 16 ];
+
+    while( ret_val && ( p_size > 0U ) )
+    {
+        size_t chunk = std::min( p_size, sizeof( scratch ) );
+        ret_val = p_stream.read( scratch, chunk );
+        p_size -= chunk;
+    }
+
+    return ret_val;
 }
 
-template < class T, size_t queueMax > 
-size_t FixedLengthList< T, queueMax >::available() const
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListStatsSnapshot FixedLengthList< T, queueMax, Links, Index, Stats >::stats( void ) const
 {
-    return queueMax - m_usedCount;
+    return this->stats_snapshot();
 }
-        
-template < class T, size_t queueMax > 
-bool FixedLengthList< T, queueMax >::inList( const T p_val ) const
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+void FixedLengthList< T, queueMax, Links, Index, Stats >::reset_stats( void )
 {
-    bool ret_val = false;
-    FixedLengthListItem<T>* p = m_usedHead;
+    this->stats_reset();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links> FixedLengthList< T, queueMax, Links, Index, Stats >::begin( void )
+{
+    return iterator( &m_items, m_usedHead, &m_usedTail );
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links> FixedLengthList< T, queueMax, Links, Index, Stats >::end( void )
+{
+    return iterator( &m_items, links_t::nil(), &m_usedTail );
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links, const T> FixedLengthList< T, queueMax, Links, Index, Stats >::begin( void ) const
+{
+    return cbegin();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links, const T> FixedLengthList< T, queueMax, Links, Index, Stats >::end( void ) const
+{
+    return cend();
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links, const T> FixedLengthList< T, queueMax, Links, Index, Stats >::cbegin( void ) const
+{
+    /* The iterator shares its representation with the non-const version,
+       but only yields const references to the items */
+    return const_iterator( const_cast< links_t* >( &m_items ), m_usedHead, &m_usedTail );
+}
 
-    /* Ordered iteration of the list checking for specified item */
-    while( p != NULL )
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links, const T> FixedLengthList< T, queueMax, Links, Index, Stats >::cend( void ) const
+{
+    return const_iterator( const_cast< links_t* >( &m_items ), links_t::nil(), &m_usedTail );
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links> FixedLengthList< T, queueMax, Links, Index, Stats >::erase( const iterator p_pos )
+{
+    link_t prev = links_t::nil();
+    iterator ret_val( &m_items, m_items.next( p_pos.m_item ), &m_usedTail );
+
+    this->stats_op( FixedLengthListStatsSnapshot::OP_ERASE );
+
+    if( links_t::doubly_linked )
     {
-        if( p->m_item == p_val ) {
-            /* Item found - flag and break out */
-            ret_val = true;
-            break;
-        } else {
-            p = p->m_forward;
+        prev = m_items.prev( p_pos.m_item );
+    }
+    else if( ( p_pos.m_prev != links_t::nil() ) && ( m_items.next( p_pos.m_prev ) == p_pos.m_item ) )
+    {
+        /* The iterator's record of the preceding item is still good */
+        prev = p_pos.m_prev;
+    }
+    else
+    {
+        prev = prev_node( p_pos.m_item );
+    }
+
+    remove_node( p_pos.m_item, prev );
+
+    /* The item preceding the returned iterator is that which preceded the
+       removed item */
+    ret_val.m_prev = prev;
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links> FixedLengthList< T, queueMax, Links, Index, Stats >::insert_after( const iterator p_pos, const T& p_item )
+{
+    iterator ret_val = end();
+
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
+    {
+        /* Inserting after end() adds to the end of the list */
+        link_t prev = ( p_pos.m_item == links_t::nil() ) ? m_usedTail : p_pos.m_item;
+
+        ret_val.m_item = m_freeHead;
+        ret_val.m_prev = prev;
+
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( p_item );
+
+        if( prev == links_t::nil() )
+        {
+            link_back();
+        }
+        else
+        {
+            link_after( prev );
         }
     }
 
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_INSERT, ( ret_val == end() ) ? 1U : 0U, m_usedCount );
+
     return ret_val;
 }
 
-template < class T, size_t queueMax >
-FixedLengthListIter<T, queueMax> FixedLengthList< T,queueMax >::begin( void )
+#if FIXEDLENGTHLIST_CXX11
+template < class T, size_t queueMax, template < class, size_t > class Links, class Index, class Stats >
+FixedLengthListIter<T, queueMax, Links> FixedLengthList< T, queueMax, Links, Index, Stats >::insert_after( const iterator p_pos, T&& p_item )
 {
-    return iterator( m_usedHead );
+    iterator ret_val = end();
+
+    /* Check that there's space in the list */
+    if( free_head() != links_t::nil() )
+    {
+        /* Inserting after end() adds to the end of the list */
+        link_t prev = ( p_pos.m_item == links_t::nil() ) ? m_usedTail : p_pos.m_item;
+
+        ret_val.m_item = m_freeHead;
+        ret_val.m_prev = prev;
+
+        /* Construct the item in the first free slot before taking it from the
+           free stack, so that the list is untouched should T's constructor
+           throw */
+        ::new( static_cast<void*>( &( m_items.item( m_freeHead ) ) ) ) T( std::move( p_item ) );
+
+        if( prev == links_t::nil() )
+        {
+            link_back();
+        }
+        else
+        {
+            link_after( prev );
+        }
+    }
+
+    this->stats_insert( FixedLengthListStatsSnapshot::OP_INSERT, ( ret_val == end() ) ? 1U : 0U, m_usedCount );
+
+    return ret_val;
 }
+#endif
 
-template < class T, size_t queueMax >
-FixedLengthListIter<T, queueMax> FixedLengthList< T,queueMax >::end( void )
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V >::FixedLengthListIter( void ) : m_links( NULL ), m_item( links_t::nil() ), m_prev( links_t::nil() ), m_tail( NULL )
 {
-    return iterator( NULL );
 }
 
-template < class T, size_t queueMax >
-FixedLengthListIter< T, queueMax >::FixedLengthListIter( void ) : m_item( NULL)
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V >::FixedLengthListIter( links_t* p_links, link_t p_item, const link_t* p_tail ) : m_links( p_links ), m_item( p_item ), m_prev( links_t::nil() ), m_tail( p_tail )
+{
+} 
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+template < class W >
+FixedLengthListIter< T, queueMax, Links, V >::FixedLengthListIter( const FixedLengthListIter< T, queueMax, Links, W >& p_other ) : m_links( p_other.m_links ), m_item( p_other.m_item ), m_prev( p_other.m_prev ), m_tail( p_other.m_tail )
 {
 }
 
-template < class T, size_t queueMax >
-FixedLengthListIter< T, queueMax >::FixedLengthListIter( FixedLengthListItem<T>* p_item ) : m_item( p_item )
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+V& FixedLengthListIter< T, queueMax, Links, V >::operator*() const
 {
+    return m_links->item( m_item );
 } 
 
-template < class T, size_t queueMax > 
-T& FixedLengthListIter< T, queueMax >::operator*()
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+V* FixedLengthListIter< T, queueMax, Links, V >::operator->() const
 {
-    return m_item->m_item;
+    return &( m_links->item( m_item ) );
 } 
 
-template < class T, size_t queueMax > 
-FixedLengthListIter< T,queueMax > FixedLengthListIter< T,queueMax >::operator++( int p_int )
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V > FixedLengthListIter< T, queueMax, Links, V >::operator++( int p_int )
 {
-    FixedLengthListIter< T,queueMax > clone( *this );
-    m_item = m_item->m_forward;
+    FixedLengthListIter< T, queueMax, Links, V > clone( *this );
+    ++( *this );
     return clone;
 } 
 
-template < class T, size_t queueMax > 
-FixedLengthListIter< T,queueMax >& FixedLengthListIter< T,queueMax >::operator++( void )
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V >& FixedLengthListIter< T, queueMax, Links, V >::operator++( void )
 {
-    m_item = m_item->m_forward;
+    m_prev = m_item;
+    m_item = m_links->next( m_item );
+    return *this;
+} 
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V > FixedLengthListIter< T, queueMax, Links, V >::operator--( int p_int )
+{
+    FixedLengthListIter< T, queueMax, Links, V > clone( *this );
+    --( *this );
+    return clone;
+} 
+
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V >& FixedLengthListIter< T, queueMax, Links, V >::operator--( void )
+{
+    /* Stepping back from end() yields the tail */
+    m_item = ( m_item == links_t::nil() ) ? *m_tail : m_links->prev( m_item );
+    m_prev = m_links->prev( m_item );
     return *this;
 } 
         
-template < class T, size_t queueMax > 
-FixedLengthListIter< T,queueMax >& FixedLengthListIter< T,queueMax >::operator+=( const unsigned p_inc ) {
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+FixedLengthListIter< T, queueMax, Links, V >& FixedLengthListIter< T, queueMax, Links, V >::operator+=( const unsigned p_inc ) {
     for(unsigned i = 0;
         i < p_inc;
         i++ )
     {
-        if( m_item == NULL ) {
+        if( m_item == links_t::nil() ) {
             break;
         } else {
-            m_item = m_item->m_forward;
+            ++( *this );
         }
     }
     return *this;
 }
 
-template < class T, size_t queueMax > 
-bool FixedLengthListIter< T,queueMax >::operator==( const FixedLengthListIter& p_comp ) const
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+bool FixedLengthListIter< T, queueMax, Links, V >::operator==( const FixedLengthListIter& p_comp ) const
 {
     return m_item == p_comp.m_item;
 }
 
-template < class T, size_t queueMax > 
-bool FixedLengthListIter< T,queueMax >::operator!=( const FixedLengthListIter& p_comp ) const
+template < class T, size_t queueMax, template < class, size_t > class Links, class V >
+bool FixedLengthListIter< T, queueMax, Links, V >::operator!=( const FixedLengthListIter& p_comp ) const
 {
     return m_item != p_comp.m_item;
 }
 
 
 #endif
-
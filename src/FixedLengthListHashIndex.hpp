@@ -0,0 +1,250 @@
+/**
+   @file
+   @brief Index policies for FixedLengthList, allowing items to be found by
+          value without walking the list.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHLISTHASHINDEX_HPP
+#define      FIXEDLENGTHLISTHASHINDEX_HPP
+
+#include <cstddef> // for size_t
+
+/**
+   An index policy is a class which FixedLengthList uses to keep track of
+   the items it holds by value.  It provides a nested class template,
+   table< Links, queueMax >, which the list inherits from and which has:
+
+   - enabled, non-zero in the case that the index is maintained
+   - index_insert() and index_erase(), called by the list once an item has
+     been constructed and before it is destroyed, respectively
+   - index_find(), which returns the link to an item matching a key, or
+     nil in the case that there is none
+
+   Items are referred to by their link within the Links policy, so items
+   must not be moved between slots without updating the index.
+
+   FixedLengthListNoIndex is the default and maintains no index, leaving
+   FixedLengthList to search by walking the list.
+*/
+class FixedLengthListNoIndex
+{
+    public:
+        template < class Links, size_t queueMax > class table
+        {
+            public:
+                enum { enabled = 0 };
+
+                typedef typename Links::link_t link_t;
+
+                void index_insert( const Links& p_links, const link_t p_link ) {}
+                void index_erase( const Links& p_links, const link_t p_link ) {}
+                template < class K > link_t index_find( const Links& p_links, const K& p_key ) const { return Links::nil(); }
+        };
+};
+
+/** Default equality comparison for FixedLengthListHashIndex, using
+    operator== */
+class FixedLengthListEqual
+{
+    public:
+        template < class T, class K > bool operator()( const T& p_item, const K& p_key ) const { return p_item == p_key; }
+};
+
+/** Compile-time calculation of the smallest power of two which is no less
+    than n */
+template < size_t n, size_t p = 1U, bool done = ( p >= n ) > class FixedLengthListPow2
+{
+    public:
+        static const size_t value = FixedLengthListPow2< n, p * 2U >::value;
+};
+
+template < size_t n, size_t p > class FixedLengthListPow2< n, p, true >
+{
+    public:
+        static const size_t value = p;
+};
+
+/**
+   Index policy for FixedLengthList which keeps a hash table of the items in
+   the list, making inList() and remove() constant time in the expected
+   case.
+
+   The table uses open addressing with linear probing and holds one link per
+   bucket, with at least twice as many buckets as queueMax so that it is
+   never more than half full.  It is held within the list, so no dynamic
+   memory is used.  Removal shifts following entries back rather than
+   leaving tombstones, so lookups don't degrade as items come and go.
+
+   Hash is a function object returning a size_t for an item (and for any
+   other key type to be passed to index_find()).  Its low bits are used to
+   select a bucket, so should be well distributed.  Equal compares an item
+   with a key.
+
+   Example:
+   \code
+          struct IntHash {
+             size_t operator()( const int p_val ) const {
+                return (size_t)p_val * 2654435761U;
+             }
+          };
+
+          FixedLengthList< int, 1000, FixedLengthListDoubleLinks,
+                           FixedLengthListHashIndex< IntHash > > pending;
+   \endcode
+*/
+template < class Hash, class Equal = FixedLengthListEqual > class FixedLengthListHashIndex
+{
+    public:
+        template < class Links, size_t queueMax > class table
+        {
+            public:
+                enum { enabled = 1 };
+
+                typedef typename Links::link_t link_t;
+
+                /** Constructor for the table.  Linear in the number of
+                    buckets */
+                table( void );
+
+                /** Add an item to the table
+
+                    \param p_links The list's link policy, holding the item
+                    \param p_link Item to be added.  Must have been constructed */
+                void index_insert( const Links& p_links, const link_t p_link );
+
+                /** Remove an item from the table
+
+                    \param p_links The list's link policy, holding the item
+                    \param p_link Item to be removed.  Must be in the table */
+                void index_erase( const Links& p_links, const link_t p_link );
+
+                /** Find an item in the table
+
+                    \param p_links The list's link policy, holding the items
+                    \param p_key Key to be matched against, using Hash and
+                                 Equal
+                    \returns Link to a matching item, or nil in the case that
+                             there is none.  Where more than one item matches
+                             it is unspecified which is returned */
+                template < class K > link_t index_find( const Links& p_links, const K& p_key ) const;
+
+            private:
+                /** Number of buckets in the table */
+                static const size_t BUCKETS = FixedLengthListPow2< 2U * queueMax >::value;
+
+                /** Map a hash value onto a bucket */
+                static size_t bucket( const size_t p_hash ) { return p_hash & ( BUCKETS - 1U ); }
+
+                Hash   m_hash;
+                Equal  m_equal;
+
+                /** Link to the item in each bucket, nil if empty */
+                link_t m_buckets[ BUCKETS ];
+        };
+};
+
+template < class Hash, class Equal >
+template < class Links, size_t queueMax >
+FixedLengthListHashIndex< Hash, Equal >::table< Links, queueMax >::table( void )
+{
+    for( size_t i = 0;
+         i < BUCKETS;
+         i++ )
+    {
+        m_buckets[ i ] = Links::nil();
+    }
+}
+
+template < class Hash, class Equal >
+template < class Links, size_t queueMax >
+void FixedLengthListHashIndex< Hash, Equal >::table< Links, queueMax >::index_insert( const Links& p_links, const link_t p_link )
+{
+    size_t i = bucket( m_hash( p_links.item( p_link ) ) );
+
+    /* Table is never more than half full, so there will be an empty
+       bucket */
+    while( m_buckets[ i ] != Links::nil() )
+    {
+        i = bucket( i + 1U );
+    }
+
+    m_buckets[ i ] = p_link;
+}
+
+template < class Hash, class Equal >
+template < class Links, size_t queueMax >
+void FixedLengthListHashIndex< Hash, Equal >::table< Links, queueMax >::index_erase( const Links& p_links, const link_t p_link )
+{
+    size_t i = bucket( m_hash( p_links.item( p_link ) ) );
+    size_t j;
+
+    while( m_buckets[ i ] != p_link )
+    {
+        i = bucket( i + 1U );
+    }
+
+    /* Bucket i is now a hole.  Move back any following entry in the same
+       run which would no longer be reachable from its home bucket, until
+       the end of the run is reached */
+    for( j = bucket( i + 1U );
+         m_buckets[ j ] != Links::nil();
+         j = bucket( j + 1U ) )
+    {
+        size_t home = bucket( m_hash( p_links.item( m_buckets[ j ] ) ) );
+
+        /* Entry can stay put if its home bucket lies cyclically within
+           ( i, j ] */
+        bool stays = ( i <= j ) ? ( ( i < home ) && ( home <= j ) )
+                                : ( ( i < home ) || ( home <= j ) );
+
+        if( !stays )
+        {
+            m_buckets[ i ] = m_buckets[ j ];
+            i = j;
+        }
+    }
+
+    m_buckets[ i ] = Links::nil();
+}
+
+template < class Hash, class Equal >
+template < class Links, size_t queueMax >
+template < class K >
+typename Links::link_t FixedLengthListHashIndex< Hash, Equal >::table< Links, queueMax >::index_find( const Links& p_links, const K& p_key ) const
+{
+    link_t ret_val = Links::nil();
+
+    for( size_t i = bucket( m_hash( p_key ) );
+         m_buckets[ i ] != Links::nil();
+         i = bucket( i + 1U ) )
+    {
+        if( m_equal( p_links.item( m_buckets[ i ] ), p_key ) )
+        {
+            ret_val = m_buckets[ i ];
+            break;
+        }
+    }
+
+    return ret_val;
+}
+
+#endif
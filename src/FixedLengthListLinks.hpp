@@ -0,0 +1,632 @@
+/**
+   @file
+   @brief Link policies used by FixedLengthList to store its items and the
+          links between them.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHLISTLINKS_HPP
+#define      FIXEDLENGTHLISTLINKS_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <stdint.h> // for uint8_t, uint16_t, uint32_t
+
+#ifndef STATIC_ASSERT
+/** Emulation of C++11's static_assert */
+#define STATIC_ASSERT( condition, name ) typedef char assert_failed_ ## name [ (condition) ? 1 : -1 ]
+#endif
+
+#if !defined FIXEDLENGTHLIST_CXX11
+/** Non-zero in the case that C++11 features (rvalue references, variadic
+    templates, type traits) are available */
+#if ( __cplusplus >= 201103L ) || ( defined( _MSC_VER ) && ( _MSC_VER >= 1900 ) )
+#define FIXEDLENGTHLIST_CXX11 1
+#else
+#define FIXEDLENGTHLIST_CXX11 0
+#endif
+#endif
+
+#if !defined FIXEDLENGTHLIST_CXX14
+/** Non-zero in the case that C++14 features (relaxed constexpr,
+    std::index_sequence) are available */
+#if ( __cplusplus >= 201402L ) || ( defined( _MSC_VER ) && ( _MSC_VER >= 1910 ) )
+#define FIXEDLENGTHLIST_CXX14 1
+#else
+#define FIXEDLENGTHLIST_CXX14 0
+#endif
+#endif
+
+#if FIXEDLENGTHLIST_CXX11
+#include <type_traits> // for is_trivially_destructible
+#include <utility> // for move(), forward(), index_sequence
+/** Allow the source of an assignment to be moved from, where supported */
+#define FIXEDLENGTHLIST_MOVE( _x ) std::move( _x )
+/** Non-zero in the case that items of type _t are known not to need
+    destroying */
+#define FIXEDLENGTHLIST_TRIVIALLY_DESTRUCTIBLE( _t ) ( std::is_trivially_destructible< _t >::value )
+/** Marks constructors which may be evaluated at compile time, so that a
+    list with static storage can be emitted as initialised data */
+#define FIXEDLENGTHLIST_CONSTEXPR constexpr
+#else
+#define FIXEDLENGTHLIST_MOVE( _x ) ( _x )
+#define FIXEDLENGTHLIST_TRIVIALLY_DESTRUCTIBLE( _t ) ( false )
+#define FIXEDLENGTHLIST_CONSTEXPR
+#endif
+
+#if !defined FIXEDLENGTHLIST_CONSTINIT
+/** May be placed on the declaration of a list with static storage to
+    require that it is initialised at compile time, giving an error should
+    construction turn out to need code to run at start up (e.g. because T
+    has a destructor or no constexpr copy constructor).  Empty in the case
+    that the compiler has no means of checking this */
+#if defined( __cpp_constinit )
+#define FIXEDLENGTHLIST_CONSTINIT constinit
+#elif FIXEDLENGTHLIST_CXX11 && defined( __GNUC__ ) && !defined( __clang__ ) && ( __GNUC__ >= 10 )
+#define FIXEDLENGTHLIST_CONSTINIT __constinit
+#elif FIXEDLENGTHLIST_CXX11 && defined( __clang__ )
+#define FIXEDLENGTHLIST_CONSTINIT [[clang::require_constant_initialization]]
+#else
+#define FIXEDLENGTHLIST_CONSTINIT
+#endif
+#endif
+
+#if FIXEDLENGTHLIST_CXX11
+
+/** Member which FixedLengthListSlot and FixedLengthListLink hold while
+    they're not in use.  Constructing it costs nothing, but allows the slot
+    to be constructed in a constant expression */
+struct FixedLengthListEmpty
+{
+};
+
+/**
+   Storage for a single item which is not constructed until the slot is put
+   into use.  This allows the pool of items to be declared without
+   default-constructing every item, and means that T need not be default
+   constructible.
+*/
+template < class T, bool trivial = std::is_trivially_destructible<T>::value > union FixedLengthListSlot
+{
+    public:
+        /** Constructor - leaves the item unconstructed */
+        constexpr FixedLengthListSlot( void ) : m_none() {}
+
+        /** Constructor - copy constructs the item from p_value */
+        constexpr FixedLengthListSlot( const T& p_value ) : m_value( p_value ) {}
+
+        /** Access the item.  Only valid while the item is constructed */
+        T& value( void ) { return m_value; }
+
+        /** Access the item.  Only valid while the item is constructed */
+        const T& value( void ) const { return m_value; }
+
+    private:
+        /** Placeholder while the slot is not in use */
+        FixedLengthListEmpty m_none;
+
+        /** The item itself */
+        T m_value;
+};
+
+/* As above, but for items with a destructor.  The slot's destructor must not
+   destroy the item, as the slot doesn't know whether it's in use */
+template < class T > union FixedLengthListSlot< T, false >
+{
+    public:
+        /** Constructor - leaves the item unconstructed */
+        constexpr FixedLengthListSlot( void ) : m_none() {}
+
+        /** Constructor - copy constructs the item from p_value */
+        constexpr FixedLengthListSlot( const T& p_value ) : m_value( p_value ) {}
+
+        /** Destructor - leaves the item untouched */
+        ~FixedLengthListSlot( void ) {}
+
+        /** Access the item.  Only valid while the item is constructed */
+        T& value( void ) { return m_value; }
+
+        /** Access the item.  Only valid while the item is constructed */
+        const T& value( void ) const { return m_value; }
+
+    private:
+        /** Placeholder while the slot is not in use */
+        FixedLengthListEmpty m_none;
+
+        /** The item itself */
+        T m_value;
+};
+
+/**
+   Storage for a link between items.  As with FixedLengthListSlot, the link
+   is left uninitialised until it is first set, so that constructing a pool
+   of items doesn't have to visit each of them.
+*/
+template < class L > union FixedLengthListLink
+{
+    public:
+        /** Constructor - leaves the link unset */
+        constexpr FixedLengthListLink( void ) : m_none() {}
+
+        /** Constructor - sets the link to p_link */
+        constexpr FixedLengthListLink( const L p_link ) : m_link( p_link ) {}
+
+        /** Retrieve the link.  Only valid once it has been set */
+        L get( void ) const { return m_link; }
+
+        /** Set the link */
+        void set( const L p_link ) { m_link = p_link; }
+
+    private:
+        /** Placeholder while the link is unset */
+        FixedLengthListEmpty m_none;
+
+        /** The link itself */
+        L m_link;
+};
+
+#else
+
+/**
+   Storage for a single item which is not constructed until the slot is put
+   into use.  This allows the pool of items to be declared without
+   default-constructing every item, and means that T need not be default
+   constructible.
+*/
+template < class T > class FixedLengthListSlot
+{
+    public:
+        /** Constructor - leaves the item unconstructed */
+        FixedLengthListSlot( void ) {}
+
+        /** Access the item.  Only valid while the item is constructed */
+        T& value( void ) { return *reinterpret_cast<T*>( m_storage.m_raw ); }
+
+        /** Access the item.  Only valid while the item is constructed */
+        const T& value( void ) const { return *reinterpret_cast<const T*>( m_storage.m_raw ); }
+
+    private:
+        /** Raw storage for the item, aligned as strictly as any fundamental
+            type */
+        union
+        {
+            unsigned char m_raw[ sizeof( T ) ];
+            long double   m_alignLongDouble;
+            double        m_alignDouble;
+            long          m_alignLong;
+            void*         m_alignPointer;
+            void          (*m_alignFunction)( void );
+        } m_storage;
+};
+
+/**
+   Storage for a link between items, left uninitialised until it is first
+   set.
+*/
+template < class L > class FixedLengthListLink
+{
+    public:
+        /** Constructor - leaves the link unset */
+        FixedLengthListLink( void ) {}
+
+        /** Retrieve the link.  Only valid once it has been set */
+        L get( void ) const { return m_link; }
+
+        /** Set the link */
+        void set( const L p_link ) { m_link = p_link; }
+
+    private:
+        /** The link itself */
+        L m_link;
+};
+
+#endif
+
+/*
+    Each item in the FixedLengthList is wrapped in a
+    FixedLengthListItem which provides the actual item and
+    infrastructure support for the list */
+template < class L > class FixedLengthListItem
+{
+    public:
+        /** Constructor - leaves the link and item unset */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListItem( void ) : m_forward(), m_item() {}
+
+#if FIXEDLENGTHLIST_CXX11
+        /** Constructor - sets the link and copy constructs the item.  There
+            is no backward link, so p_back is ignored */
+        constexpr FixedLengthListItem( FixedLengthListItem<L>* const p_forward, FixedLengthListItem<L>* const p_back, const L& p_item )
+            : m_forward( p_forward ), m_item( p_item ) {}
+#endif
+
+        /** Pointer to the next item in the list */
+        FixedLengthListLink< FixedLengthListItem<L>* > m_forward;
+        /** The content/value of the item itself */
+        FixedLengthListSlot<L>  m_item;
+};
+
+/*
+    As FixedLengthListItem, but with an additional link to the preceding
+    item in the list */
+template < class L > class FixedLengthListDoubleItem
+{
+    public:
+        /** Constructor - leaves the links and item unset */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListDoubleItem( void ) : m_forward(), m_back(), m_item() {}
+
+#if FIXEDLENGTHLIST_CXX11
+        /** Constructor - sets the links and copy constructs the item */
+        constexpr FixedLengthListDoubleItem( FixedLengthListDoubleItem<L>* const p_forward, FixedLengthListDoubleItem<L>* const p_back, const L& p_item )
+            : m_forward( p_forward ), m_back( p_back ), m_item( p_item ) {}
+#endif
+
+        /** Pointer to the next item in the list */
+        FixedLengthListLink< FixedLengthListDoubleItem<L>* > m_forward;
+        /** Pointer to the previous item in the list */
+        FixedLengthListLink< FixedLengthListDoubleItem<L>* > m_back;
+        /** The content/value of the item itself */
+        FixedLengthListSlot<L>        m_item;
+};
+
+/**
+   Storage shared by the pointer based link policies.  Items are held in an
+   array of I, with each item linked to the next by pointer.
+
+   A link policy is the class FixedLengthList uses to hold its pool of items.
+   It provides:
+   - link_t, the type used to refer to an item (and therefore the type of the
+     head/tail/free pointers within the list)
+   - nil(), the link_t value used to indicate "no item"
+   - slot()/index() to convert between a position in the pool and a link_t
+   - item() to access the content of an item.  Items are held in
+     FixedLengthListSlot and are only constructed while in use
+   - next()/set_next() and prev()/set_prev() to navigate and update the links
+   - doubly_linked, which is non-zero in the case that prev() is maintained
+   - contiguous, which is non-zero in the case that the items are held in an
+     array of T (with no padding between them) pointed to by values()
+   - a default constructor, which leaves all of the items and links unset
+   - (C++14) a constructor taking an array of items and an index_sequence
+     with one index per item, which constructs the items in the first
+     slots and links them in order, in a way which may be evaluated at
+     compile time
+*/
+template < class I, class T, size_t queueMax > class FixedLengthListPointerLinks
+{
+    public:
+        /** Items are interleaved with their links */
+        enum { contiguous = 0 };
+
+        /** Type of the items */
+        typedef T value_type;
+
+        /** Type used to refer to an item in the pool */
+        typedef I* link_t;
+
+        /** Constructor - leaves all items unset */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListPointerLinks( void ) : m_items() {}
+
+#if FIXEDLENGTHLIST_CXX14
+        /** Constructor - copy constructs p_items into the first slots of the
+            pool, each linked to its neighbours */
+        template < size_t... Is > constexpr FixedLengthListPointerLinks( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : m_items{ { ( Is + 1U < sizeof...( Is ) ) ? slot( Is + 1U ) : nil(),
+                         ( Is > 0U ) ? slot( Is - 1U ) : nil(),
+                         p_items[ Is ] }... } {}
+#endif
+
+        /** Link value used to indicate the absence of an item */
+        static FIXEDLENGTHLIST_CONSTEXPR link_t nil( void ) { return NULL; }
+
+        /** Retrieve the link referring to the item at position p_index in the
+            pool.  Links always refer to the (mutable) pool, regardless of
+            how they were obtained */
+        FIXEDLENGTHLIST_CONSTEXPR link_t slot( size_t p_index ) const { return const_cast< I* >( &( m_items[ p_index ] ) ); }
+
+        /** Items are not contiguous, so this must not be called.  Provided
+            only so that code which checks contiguous compiles for both kinds
+            of policy */
+        const T* values( void ) const { return NULL; }
+
+        /** Retrieve the position in the pool of the item referred to by
+            p_link */
+        size_t index( const link_t p_link ) const { return p_link - m_items; }
+
+        /** Access the content of the item referred to by p_link */
+        T& item( const link_t p_link ) { return p_link->m_item.value(); }
+
+        /** Access the content of the item referred to by p_link */
+        const T& item( const link_t p_link ) const { return p_link->m_item.value(); }
+
+        /** Retrieve the item following p_link */
+        link_t next( const link_t p_link ) const { return p_link->m_forward.get(); }
+
+        /** Set the item following p_link */
+        void set_next( const link_t p_link, const link_t p_next ) { p_link->m_forward.set( p_next ); }
+
+    protected:
+        /** Pool of list items */
+        I m_items[ queueMax ];
+};
+
+/**
+   Link policy in which each item has a single pointer to the next item in
+   the list.  Removing the last item in the list (or finding the predecessor
+   of any other item) requires a walk of the list.
+
+   This is the default policy for FixedLengthList.
+*/
+template < class T, size_t queueMax > class FixedLengthListSingleLinks
+    : public FixedLengthListPointerLinks< FixedLengthListItem<T>, T, queueMax >
+{
+    public:
+        enum { doubly_linked = 0 };
+
+        typedef typename FixedLengthListPointerLinks< FixedLengthListItem<T>, T, queueMax >::link_t link_t;
+
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListSingleLinks( void ) {}
+
+#if FIXEDLENGTHLIST_CXX14
+        template < size_t... Is > constexpr FixedLengthListSingleLinks( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : FixedLengthListPointerLinks< FixedLengthListItem<T>, T, queueMax >( p_items, p_seq ) {}
+#endif
+
+        /** Items do not track their predecessor, so this must not be called
+            unless doubly_linked is set.  Provided only so that the list
+            implementation compiles for both kinds of policy */
+        link_t prev( const link_t p_link ) const { return NULL; }
+
+        /** Items do not track their predecessor - no-op */
+        void set_prev( const link_t p_link, const link_t p_prev ) {}
+};
+
+/**
+   Link policy in which each item has a pointer to both the next and the
+   previous item in the list.  This costs an additional pointer per item but
+   allows the last item (or any other item) to be unlinked in constant time,
+   making FixedLengthList::dequeue() O(1).
+*/
+template < class T, size_t queueMax > class FixedLengthListDoubleLinks
+    : public FixedLengthListPointerLinks< FixedLengthListDoubleItem<T>, T, queueMax >
+{
+    public:
+        enum { doubly_linked = 1 };
+
+        typedef typename FixedLengthListPointerLinks< FixedLengthListDoubleItem<T>, T, queueMax >::link_t link_t;
+
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListDoubleLinks( void ) {}
+
+#if FIXEDLENGTHLIST_CXX14
+        template < size_t... Is > constexpr FixedLengthListDoubleLinks( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : FixedLengthListPointerLinks< FixedLengthListDoubleItem<T>, T, queueMax >( p_items, p_seq ) {}
+#endif
+
+        /** Retrieve the item preceding p_link */
+        link_t prev( const link_t p_link ) const { return p_link->m_back.get(); }
+
+        /** Set the item preceding p_link */
+        void set_prev( const link_t p_link, const link_t p_prev ) { p_link->m_back.set( p_prev ); }
+};
+
+/**
+   Selects the smallest unsigned type able to index count items while still
+   leaving the maximum value of the type free for use as a "no item" sentinel
+*/
+template < size_t count, bool fits8 = ( count <= 0xFFU ), bool fits16 = ( count <= 0xFFFFU ) >
+struct FixedLengthListIndex
+{
+    typedef uint32_t type;
+};
+
+template < size_t count, bool fits16 >
+struct FixedLengthListIndex< count, true, fits16 >
+{
+    typedef uint8_t type;
+};
+
+template < size_t count >
+struct FixedLengthListIndex< count, false, true >
+{
+    typedef uint16_t type;
+};
+
+/**
+   Arrays held by the index based link policies - the items, along with the
+   forward and (where doubly is set) backward links of each.  Gathered in a
+   single class, rather than spread through the hierarchy of the policy, so
+   that the policies (and lists using them) are standard layout.
+*/
+template < class T, class L, size_t queueMax, bool doubly > class FixedLengthListIndexStore
+{
+    public:
+        /** Constructor - leaves all items unset */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListIndexStore( void ) : m_items(), m_forward() {}
+
+#if FIXEDLENGTHLIST_CXX14
+        /** Constructor - copy constructs p_items into the first slots of the
+            pool, each linked to the next */
+        template < size_t... Is > constexpr FixedLengthListIndexStore( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : m_items{ { p_items[ Is ] }... },
+              m_forward{ { link( Is + 1U, sizeof...( Is ) ) }... } {}
+
+        /** The link to position p_index in a run of p_count items, or the
+            "no item" sentinel if p_index is outside the run */
+        static constexpr L link( const size_t p_index, const size_t p_count ) { return ( p_index < p_count ) ? (L)p_index : (L)~(L)0U; }
+#endif
+
+        /** Pool of list items */
+        FixedLengthListSlot<T> m_items[ queueMax ];
+
+        /** Index of the next item for each item in m_items */
+        FixedLengthListLink<L> m_forward[ queueMax ];
+};
+
+/* As above, with backward links */
+template < class T, class L, size_t queueMax > class FixedLengthListIndexStore< T, L, queueMax, true >
+{
+    public:
+        /** Constructor - leaves all items unset */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListIndexStore( void ) : m_items(), m_forward(), m_back() {}
+
+#if FIXEDLENGTHLIST_CXX14
+        /** Constructor - copy constructs p_items into the first slots of the
+            pool, each linked to its neighbours */
+        template < size_t... Is > constexpr FixedLengthListIndexStore( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : m_items{ { p_items[ Is ] }... },
+              m_forward{ { FixedLengthListIndexStore< T, L, queueMax, false >::link( Is + 1U, sizeof...( Is ) ) }... },
+              m_back{ { FixedLengthListIndexStore< T, L, queueMax, false >::link( Is - 1U, sizeof...( Is ) ) }... } {}
+#endif
+
+        /** Pool of list items */
+        FixedLengthListSlot<T> m_items[ queueMax ];
+
+        /** Index of the next item for each item in m_items */
+        FixedLengthListLink<L> m_forward[ queueMax ];
+
+        /** Index of the previous item for each item in m_items */
+        FixedLengthListLink<L> m_back[ queueMax ];
+};
+
+/**
+   Storage shared by the index based link policies.  Rather than pointers,
+   items are linked by their position in the pool, stored in the smallest
+   unsigned type able to address queueMax items (see FixedLengthListIndex).
+   The links are kept in an array separate from the items themselves so that
+   neither has to be padded out to the alignment of the other.
+
+   As the links are relative to the start of the pool the storage is position
+   independent - a list using these policies may be copied with memcpy() (if T
+   allows it) and remains valid.
+*/
+template < class T, size_t queueMax, bool doubly > class FixedLengthListIndexLinks
+{
+    /* Must leave the maximum value of the largest index type free for use as
+       the "no item" sentinel */
+    STATIC_ASSERT( queueMax < 0xFFFFFFFFUL, Queue_too_long_for_index_links );
+
+    public:
+        /** Items are held in an array of their own.  In C++03 the slots may
+            be padded for alignment, in which case they are not contiguous */
+        enum { contiguous = ( sizeof( FixedLengthListSlot<T> ) == sizeof( T ) ) };
+
+        /** Type of the items */
+        typedef T value_type;
+
+        /** Type used to refer to an item in the pool */
+        typedef typename FixedLengthListIndex< queueMax >::type link_t;
+
+        /** Constructor - leaves all items unset */
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListIndexLinks( void ) : m_store() {}
+
+#if FIXEDLENGTHLIST_CXX14
+        /** Constructor - copy constructs p_items into the first slots of the
+            pool, each linked to its neighbours */
+        template < size_t... Is > constexpr FixedLengthListIndexLinks( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : m_store( p_items, p_seq ) {}
+#endif
+
+        /** Link value used to indicate the absence of an item */
+        static FIXEDLENGTHLIST_CONSTEXPR link_t nil( void ) { return (link_t)~(link_t)0U; }
+
+        /** Retrieve the link referring to the item at position p_index in the
+            pool */
+        FIXEDLENGTHLIST_CONSTEXPR link_t slot( size_t p_index ) const { return (link_t)p_index; }
+
+        /** Retrieve the position in the pool of the item referred to by
+            p_link */
+        size_t index( const link_t p_link ) const { return p_link; }
+
+        /** Access the content of the item referred to by p_link */
+        T& item( const link_t p_link ) { return m_store.m_items[ p_link ].value(); }
+
+        /** Access the content of the item referred to by p_link */
+        const T& item( const link_t p_link ) const { return m_store.m_items[ p_link ].value(); }
+
+        /** Start of the array of items, only valid if contiguous is set.
+            Slots which are not in use hold no item */
+        const T* values( void ) const { return &( m_store.m_items[ 0 ].value() ); }
+
+        /** Retrieve the item following p_link */
+        link_t next( const link_t p_link ) const { return m_store.m_forward[ p_link ].get(); }
+
+        /** Set the item following p_link */
+        void set_next( const link_t p_link, const link_t p_next ) { m_store.m_forward[ p_link ].set( p_next ); }
+
+    protected:
+        /** Pool of list items and their links */
+        FixedLengthListIndexStore< T, link_t, queueMax, doubly > m_store;
+};
+
+/**
+   Link policy in which each item has the index of the next item in the list.
+   Equivalent to FixedLengthListSingleLinks but with a smaller footprint and
+   position independent storage.
+*/
+template < class T, size_t queueMax > class FixedLengthListCompactSingleLinks
+    : public FixedLengthListIndexLinks< T, queueMax, false >
+{
+    public:
+        enum { doubly_linked = 0 };
+
+        typedef typename FixedLengthListIndexLinks< T, queueMax, false >::link_t link_t;
+
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListCompactSingleLinks( void ) {}
+
+#if FIXEDLENGTHLIST_CXX14
+        template < size_t... Is > constexpr FixedLengthListCompactSingleLinks( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : FixedLengthListIndexLinks< T, queueMax, false >( p_items, p_seq ) {}
+#endif
+
+        /** Items do not track their predecessor, so this must not be called
+            unless doubly_linked is set.  Provided only so that the list
+            implementation compiles for both kinds of policy */
+        link_t prev( const link_t p_link ) const { return FixedLengthListIndexLinks< T, queueMax, false >::nil(); }
+
+        /** Items do not track their predecessor - no-op */
+        void set_prev( const link_t p_link, const link_t p_prev ) {}
+};
+
+/**
+   Link policy in which each item has the index of both the next and the
+   previous item in the list.  Equivalent to FixedLengthListDoubleLinks but
+   with a smaller footprint and position independent storage.
+*/
+template < class T, size_t queueMax > class FixedLengthListCompactDoubleLinks
+    : public FixedLengthListIndexLinks< T, queueMax, true >
+{
+    public:
+        enum { doubly_linked = 1 };
+
+        typedef typename FixedLengthListIndexLinks< T, queueMax, true >::link_t link_t;
+
+        FIXEDLENGTHLIST_CONSTEXPR FixedLengthListCompactDoubleLinks( void ) {}
+
+#if FIXEDLENGTHLIST_CXX14
+        template < size_t... Is > constexpr FixedLengthListCompactDoubleLinks( const T* const p_items, std::index_sequence< Is... > p_seq )
+            : FixedLengthListIndexLinks< T, queueMax, true >( p_items, p_seq ) {}
+#endif
+
+        /** Retrieve the item preceding p_link */
+        link_t prev( const link_t p_link ) const { return this->m_store.m_back[ p_link ].get(); }
+
+        /** Set the item preceding p_link */
+        void set_prev( const link_t p_link, const link_t p_prev ) { this->m_store.m_back[ p_link ].set( p_prev ); }
+};
+
+#endif
@@ -0,0 +1,341 @@
+/**
+   @file
+   @brief Index policy for FixedLengthList which finds items by scanning the
+          pool with vector compares.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHLISTSCANINDEX_HPP
+#define      FIXEDLENGTHLISTSCANINDEX_HPP
+
+#include <cstddef> // for size_t
+#include <cstring> // for memcpy()
+#include <stdint.h> // for uint32_t
+
+#include "FixedLengthListLinks.hpp"
+
+/* Pick the widest vector compare available.  Define FIXEDLENGTHLIST_NO_SIMD
+   to force the portable scalar scan */
+#if !defined FIXEDLENGTHLIST_NO_SIMD
+#if defined __AVX2__
+#include <immintrin.h>
+/** Number of bytes compared by each vector compare */
+#define FIXEDLENGTHLIST_SIMD_BYTES (32U)
+typedef __m256i fixedlengthlist_vec_t;
+static inline fixedlengthlist_vec_t fixedlengthlist_vec_load( const void* p_src ) { return _mm256_loadu_si256( static_cast<const __m256i*>( p_src ) ); }
+/** Compare p_a and p_b as elements of p_size bytes, returning a bit per
+    byte which is set for each byte of each element which is equal */
+static inline uint32_t fixedlengthlist_vec_match( const fixedlengthlist_vec_t p_a, const fixedlengthlist_vec_t p_b, const size_t p_size )
+{
+    fixedlengthlist_vec_t eq;
+
+    switch( p_size )
+    {
+        case 1:  eq = _mm256_cmpeq_epi8( p_a, p_b );  break;
+        case 2:  eq = _mm256_cmpeq_epi16( p_a, p_b ); break;
+        case 8:  eq = _mm256_cmpeq_epi64( p_a, p_b ); break;
+        default: eq = _mm256_cmpeq_epi32( p_a, p_b ); break;
+    }
+
+    return (uint32_t)_mm256_movemask_epi8( eq );
+}
+#elif defined __SSE2__ || defined _M_X64 || ( defined _M_IX86_FP && ( _M_IX86_FP >= 2 ) )
+#include <emmintrin.h>
+/** Number of bytes compared by each vector compare */
+#define FIXEDLENGTHLIST_SIMD_BYTES (16U)
+typedef __m128i fixedlengthlist_vec_t;
+static inline fixedlengthlist_vec_t fixedlengthlist_vec_load( const void* p_src ) { return _mm_loadu_si128( static_cast<const __m128i*>( p_src ) ); }
+/** Compare p_a and p_b as elements of p_size bytes, returning a bit per
+    byte which is set for each byte of each element which is equal */
+static inline uint32_t fixedlengthlist_vec_match( const fixedlengthlist_vec_t p_a, const fixedlengthlist_vec_t p_b, const size_t p_size )
+{
+    fixedlengthlist_vec_t eq;
+
+    switch( p_size )
+    {
+        case 1:  eq = _mm_cmpeq_epi8( p_a, p_b );  break;
+        case 2:  eq = _mm_cmpeq_epi16( p_a, p_b ); break;
+        case 8:
+            /* No 64-bit compare in SSE2, so both 32-bit halves must match */
+            eq = _mm_cmpeq_epi32( p_a, p_b );
+            eq = _mm_and_si128( eq, _mm_shuffle_epi32( eq, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+            break;
+        default: eq = _mm_cmpeq_epi32( p_a, p_b ); break;
+    }
+
+    return (uint32_t)_mm_movemask_epi8( eq );
+}
+#endif
+#endif
+
+/* Items can only be compared byte-wise if equality means identical bytes,
+   which isn't the case for floating point (+0 == -0, NaN != NaN) or class
+   types.  Determining this needs C++11 */
+#if FIXEDLENGTHLIST_CXX11 && defined FIXEDLENGTHLIST_SIMD_BYTES
+#define FIXEDLENGTHLIST_SIMD_COMPARABLE( _t ) ( std::is_integral< _t >::value || std::is_pointer< _t >::value || std::is_enum< _t >::value )
+#else
+#define FIXEDLENGTHLIST_SIMD_COMPARABLE( _t ) ( false )
+#endif
+
+/**
+   Index policy for FixedLengthList (see FixedLengthListHashIndex.hpp) which
+   keeps a bitmask of the slots in use and finds items by scanning the pool
+   directly, rather than following the links from item to item.
+
+   Where the link policy holds the items contiguously (the compact policies,
+   when built as C++11) and T is an integer, enum or pointer type, the scan
+   uses SSE2 or AVX2 compares over the raw pool, checking the bitmask only
+   for candidate matches.  The scan covers the slots up to the highest one
+   in use, so the list's lazy initialisation keeps it short for lists which
+   are mostly empty, and it shortens again as the highest items are removed
+   (e.g. by clear()).  Otherwise the bitmask is used to visit
+   the slots in use in turn, comparing with operator==.
+
+   Compared to FixedLengthListHashIndex this needs no hash function and only
+   one bit per item, but finding an item is still linear in the size of the
+   pool - just with a much smaller constant.
+
+   As with the hash index, where more than one item matches it is
+   unspecified which is found.  Note that slots which are not in use are
+   read by the vector scan, so tools which track uninitialised memory (e.g.
+   MemorySanitizer) may report them.
+
+   Example:
+   \code
+          FixedLengthList< int, 4096, FixedLengthListCompactDoubleLinks,
+                           FixedLengthListScanIndex > pending;
+   \endcode
+*/
+class FixedLengthListScanIndex
+{
+    public:
+        template < class Links, size_t queueMax > class table
+        {
+            public:
+                enum { enabled = 1 };
+
+                typedef typename Links::link_t link_t;
+                typedef typename Links::value_type value_type;
+
+                /** Constructor for the table.  Linear in queueMax / 32 */
+                table( void );
+
+                /** Mark an item as in use
+
+                    \param p_links The list's link policy, holding the item
+                    \param p_link Item which is now in use */
+                void index_insert( const Links& p_links, const link_t p_link );
+
+                /** Mark an item as no longer in use
+
+                    \param p_links The list's link policy, holding the item
+                    \param p_link Item which is no longer in use */
+                void index_erase( const Links& p_links, const link_t p_link );
+
+                /** Find an item in the pool
+
+                    \param p_links The list's link policy, holding the items
+                    \param p_key Item to be matched against
+                    \returns Link to a matching item, or nil in the case that
+                             there is none */
+                link_t index_find( const Links& p_links, const value_type& p_key ) const;
+
+                /** Number of slots covered by a scan
+
+                    \returns One more than the highest slot in use, rounded up
+                             to a whole word of the bitmask */
+                size_t limit( void ) const { return m_limit; }
+
+            private:
+                /** Number of 32-bit words in the bitmask */
+                static const size_t WORDS = ( queueMax + 31U ) / 32U;
+
+                /** Determine whether or not the slot at position p_index is
+                    in use */
+                bool occupied( const size_t p_index ) const { return ( ( m_occupied[ p_index / 32U ] >> ( p_index % 32U ) ) & 1U ) != 0U; }
+
+                /** Scan using operator==, visiting only the slots in use */
+                link_t find_scalar( const Links& p_links, const value_type& p_key ) const;
+
+                /** Scan using vector compares.  Only valid in the case that
+                    the items are contiguous and can be compared byte-wise */
+                link_t find_vector( const Links& p_links, const value_type& p_key ) const;
+
+                /** One bit per slot, set while the slot is in use */
+                uint32_t m_occupied[ WORDS ];
+
+                /** One more than the highest slot in use, rounded up to a
+                    whole word of the bitmask once items are erased.  No
+                    slots at or beyond this point are in use */
+                size_t m_limit;
+        };
+};
+
+template < class Links, size_t queueMax >
+FixedLengthListScanIndex::table< Links, queueMax >::table( void ) : m_limit( 0U )
+{
+    for( size_t i = 0;
+         i < WORDS;
+         i++ )
+    {
+        m_occupied[ i ] = 0U;
+    }
+}
+
+template < class Links, size_t queueMax >
+void FixedLengthListScanIndex::table< Links, queueMax >::index_insert( const Links& p_links, const link_t p_link )
+{
+    size_t i = p_links.index( p_link );
+
+    m_occupied[ i / 32U ] |= ( (uint32_t)1U << ( i % 32U ) );
+
+    if( i >= m_limit )
+    {
+        m_limit = i + 1U;
+    }
+}
+
+template < class Links, size_t queueMax >
+void FixedLengthListScanIndex::table< Links, queueMax >::index_erase( const Links& p_links, const link_t p_link )
+{
+    size_t i = p_links.index( p_link );
+
+    m_occupied[ i / 32U ] &= ~( (uint32_t)1U << ( i % 32U ) );
+
+    /* Pull the limit back past any words at the top of the bitmask which
+       are now empty, so that scans don't cover them */
+    while( ( m_limit > 0U ) && ( m_occupied[ ( m_limit - 1U ) / 32U ] == 0U ) )
+    {
+        m_limit = ( ( m_limit - 1U ) / 32U ) * 32U;
+    }
+}
+
+template < class Links, size_t queueMax >
+typename Links::link_t FixedLengthListScanIndex::table< Links, queueMax >::index_find( const Links& p_links, const value_type& p_key ) const
+{
+    link_t ret_val;
+
+    /* Constant condition - only one of the paths is kept */
+    if( Links::contiguous && FIXEDLENGTHLIST_SIMD_COMPARABLE( value_type ) )
+    {
+        ret_val = find_vector( p_links, p_key );
+    }
+    else
+    {
+        ret_val = find_scalar( p_links, p_key );
+    }
+
+    return ret_val;
+}
+
+template < class Links, size_t queueMax >
+typename Links::link_t FixedLengthListScanIndex::table< Links, queueMax >::find_scalar( const Links& p_links, const value_type& p_key ) const
+{
+    link_t ret_val = Links::nil();
+
+    for( size_t w = 0;
+         ( ( w * 32U ) < m_limit ) && ( ret_val == Links::nil() );
+         w++ )
+    {
+        uint32_t bits = m_occupied[ w ];
+
+        /* Visit each set bit in turn, lowest first */
+        for( size_t i = w * 32U;
+             bits != 0U;
+             i++, bits >>= 1 )
+        {
+            if( ( ( bits & 1U ) != 0U ) &&
+                ( p_links.item( p_links.slot( i ) ) == p_key ) )
+            {
+                ret_val = p_links.slot( i );
+                break;
+            }
+        }
+    }
+
+    return ret_val;
+}
+
+template < class Links, size_t queueMax >
+typename Links::link_t FixedLengthListScanIndex::table< Links, queueMax >::find_vector( const Links& p_links, const value_type& p_key ) const
+{
+    link_t ret_val = Links::nil();
+    size_t i = 0;
+
+#if defined FIXEDLENGTHLIST_SIMD_BYTES
+    const size_t size = sizeof( value_type );
+    const size_t per_vec = FIXEDLENGTHLIST_SIMD_BYTES / size;
+    /* Bits set in the compare result for an item whose bytes all match */
+    const uint32_t all = (uint32_t)( ( 1UL << size ) - 1U );
+    const unsigned char* base = reinterpret_cast<const unsigned char*>( p_links.values() );
+    unsigned char pattern[ FIXEDLENGTHLIST_SIMD_BYTES ];
+
+    /* Items are a power of two in size, so a whole number of them fit in a
+       vector, aligned with the start of each */
+    for( size_t b = 0;
+         b < FIXEDLENGTHLIST_SIMD_BYTES;
+         b += size )
+    {
+        memcpy( &( pattern[ b ] ), &p_key, size );
+    }
+
+    const fixedlengthlist_vec_t key = fixedlengthlist_vec_load( pattern );
+
+    for( ;
+         ( ( i + per_vec ) <= m_limit ) && ( ret_val == Links::nil() );
+         i += per_vec )
+    {
+        uint32_t match = fixedlengthlist_vec_match( fixedlengthlist_vec_load( base + ( i * size ) ), key, size );
+
+        /* Matches are rare, so only then look at individual items.  An item
+           only matches if all of its bytes do, as wider items (e.g.
+           __int128) are compared in parts */
+        if( match != 0U )
+        {
+            for( size_t k = 0;
+                 k < per_vec;
+                 k++ )
+            {
+                if( ( ( ( match >> ( k * size ) ) & all ) == all ) && occupied( i + k ) )
+                {
+                    ret_val = p_links.slot( i + k );
+                    break;
+                }
+            }
+        }
+    }
+#endif
+
+    /* Any remaining items which don't fill a vector */
+    for( ;
+         ( i < m_limit ) && ( ret_val == Links::nil() );
+         i++ )
+    {
+        if( occupied( i ) && ( p_links.item( p_links.slot( i ) ) == p_key ) )
+        {
+            ret_val = p_links.slot( i );
+        }
+    }
+
+    return ret_val;
+}
+
+#endif
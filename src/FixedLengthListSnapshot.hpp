@@ -0,0 +1,158 @@
+/**
+   @file
+   @brief Binary format used by FixedLengthList::snapshot() and restore(),
+          along with streams to write and read it from memory.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHLISTSNAPSHOT_HPP
+#define      FIXEDLENGTHLISTSNAPSHOT_HPP
+
+#include <cstddef> // for size_t
+#include <cstring> // for memcpy()
+#include <stdint.h> // for uint16_t, uint32_t
+
+/**
+   Header at the start of a snapshot of a FixedLengthList.  It is followed
+   by m_count items of m_itemSize bytes each, in list order, as their raw
+   bytes.  All fields are in the byte order of the machine taking the
+   snapshot - the format is intended for saving state across a restart,
+   rather than for exchange between machines.
+
+   m_headerSize allows later versions to extend the header - a reader skips
+   any bytes beyond those it knows about.
+*/
+class FixedLengthListSnapshotHeader
+{
+    public:
+        enum
+        {
+            /** Value of m_magic, "FLLS" when read as bytes on a little endian
+                machine */
+            MAGIC = 0x534C4C46UL,
+            /** Current value of m_version */
+            VERSION = 1U
+        };
+
+        /** Identifies the data as a snapshot */
+        uint32_t m_magic;
+
+        /** Version of the format */
+        uint16_t m_version;
+
+        /** Size of the header in bytes, i.e. offset of the first item */
+        uint16_t m_headerSize;
+
+        /** sizeof() each item */
+        uint32_t m_itemSize;
+
+        /** Number of items which follow */
+        uint32_t m_count;
+};
+
+/**
+   Stream writing a snapshot to a buffer in memory.  Any class with a write()
+   method of the same form may be used to write a snapshot elsewhere (e.g. to
+   a file).
+*/
+class FixedLengthListBufferWriter
+{
+    public:
+        /** Constructor
+
+            \param p_buffer Buffer to be written to
+            \param p_size Size of the buffer, in bytes */
+        FixedLengthListBufferWriter( void* const p_buffer, const size_t p_size )
+            : m_buffer( static_cast< unsigned char* >( p_buffer ) ), m_size( p_size ), m_used( 0U ) {}
+
+        /** Append p_size bytes from p_data to the buffer
+
+            \returns true in the case that the data was written, false in the
+                     case that there wasn't space for it */
+        bool write( const void* const p_data, const size_t p_size );
+
+        /** Number of bytes written so far */
+        size_t used( void ) const { return m_used; }
+
+    private:
+        unsigned char* m_buffer;
+        size_t         m_size;
+        size_t         m_used;
+};
+
+/**
+   Stream reading a snapshot from a buffer in memory.  Any class with a read()
+   method of the same form may be used to read a snapshot from elsewhere.
+*/
+class FixedLengthListBufferReader
+{
+    public:
+        /** Constructor
+
+            \param p_buffer Buffer to be read from
+            \param p_size Size of the buffer, in bytes */
+        FixedLengthListBufferReader( const void* const p_buffer, const size_t p_size )
+            : m_buffer( static_cast< const unsigned char* >( p_buffer ) ), m_size( p_size ), m_used( 0U ) {}
+
+        /** Read the next p_size bytes from the buffer into p_data
+
+            \returns true in the case that the data was read, false in the
+                     case that the buffer holds fewer than p_size more bytes */
+        bool read( void* const p_data, const size_t p_size );
+
+        /** Number of bytes read so far */
+        size_t used( void ) const { return m_used; }
+
+    private:
+        const unsigned char* m_buffer;
+        size_t               m_size;
+        size_t               m_used;
+};
+
+inline bool FixedLengthListBufferWriter::write( const void* const p_data, const size_t p_size )
+{
+    bool ret_val = false;
+
+    if( p_size <= ( m_size - m_used ) )
+    {
+        memcpy( m_buffer + m_used, p_data, p_size );
+        m_used += p_size;
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+inline bool FixedLengthListBufferReader::read( void* const p_data, const size_t p_size )
+{
+    bool ret_val = false;
+
+    if( p_size <= ( m_size - m_used ) )
+    {
+        memcpy( p_data, m_buffer + m_used, p_size );
+        m_used += p_size;
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+#endif
@@ -0,0 +1,213 @@
+/**
+   @file
+   @brief Instrumentation policies for FixedLengthList, recording how full
+          the list gets and how much work its searches do.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHLISTSTATS_HPP
+#define      FIXEDLENGTHLISTSTATS_HPP
+
+#include <cstddef> // for size_t
+
+/**
+   Counters recorded by FixedLengthListStats, as returned by
+   FixedLengthList::stats()
+*/
+class FixedLengthListStatsSnapshot
+{
+    public:
+        /** Operations which are counted */
+        enum
+        {
+            OP_PUSH = 0,  /**< push(), emplace_front() and push_n() */
+            OP_QUEUE,     /**< queue(), emplace_back() and queue_n() */
+            OP_POP,       /**< pop() and pop_n() */
+            OP_DEQUEUE,   /**< dequeue() and dequeue_n() */
+            OP_REMOVE,    /**< remove() */
+            OP_SEARCH,    /**< inList() */
+            OP_SPLICE,    /**< splice_back(), counted by the receiving list */
+            OP_CLEAR,     /**< clear() */
+            OP_INSERT,    /**< insert_after() */
+            OP_ERASE,     /**< erase() */
+            OP_COUNT
+        };
+
+        /** Number of buckets in the histogram of search lengths.  Bucket 0
+            counts searches which visited no items, bucket n (n > 0) those
+            which visited from 2^(n-1) to 2^n - 1 items, with the last
+            bucket also counting any longer searches */
+        enum { SCAN_BUCKETS = 17 };
+
+        /** Highest value of used() seen */
+        size_t m_peakUsed;
+
+        /** Number of items which could not be added as the list was full */
+        size_t m_rejected;
+
+        /** Number of calls made to each operation, including those which
+            failed, indexed by OP_xxx */
+        size_t m_ops[ OP_COUNT ];
+
+        /** Histogram of the number of items visited by each walk of the list
+            made to find an item (by remove(), inList() and, where there are
+            no backward links, dequeue(), erase() and removal via an index) */
+        size_t m_scans[ SCAN_BUCKETS ];
+
+        /** Constructor - all counters are zero */
+        FixedLengthListStatsSnapshot( void );
+
+        /** Map a search length onto a bucket of m_scans */
+        static size_t scan_bucket( size_t p_nodes );
+};
+
+/**
+   An instrumentation policy is a class which FixedLengthList inherits from
+   and calls as items are added, removed and searched for.  It provides:
+
+   - enabled, non-zero in the case that counters are maintained
+   - stats_insert(), called once per insert operation with the number of
+     items rejected and the resulting used() count
+   - stats_op(), called once per other operation
+   - stats_scan(), called with the number of items visited by each walk of
+     the list
+   - stats_snapshot() and stats_reset() to retrieve and reset the counters
+
+   Hooks are const, as searches are made by const methods.
+
+   FixedLengthListNoStats is the default.  It has no members, so takes no
+   space in the list, and its hooks are empty, so are compiled out
+   completely.
+*/
+class FixedLengthListNoStats
+{
+    public:
+        enum { enabled = 0 };
+
+        void stats_insert( const unsigned p_op, const size_t p_rejected, const size_t p_used ) const {}
+        void stats_op( const unsigned p_op ) const {}
+        void stats_scan( const size_t p_nodes ) const {}
+        FixedLengthListStatsSnapshot stats_snapshot( void ) const { return FixedLengthListStatsSnapshot(); }
+        void stats_reset( void ) {}
+};
+
+/**
+   Instrumentation policy for FixedLengthList which records, for each list,
+   the peak number of items, the number of items rejected as the list was
+   full, the number of calls made to each operation and a histogram of the
+   length of searches (see FixedLengthListStatsSnapshot).  This allows the
+   capacity of the list to be sized from real use.
+
+   The counters are held within the list and are not thread safe.  They
+   are not copied along with the list's items.
+
+   Example:
+   \code
+          FixedLengthList< Msg, 64, FixedLengthListSingleLinks,
+                           FixedLengthListNoIndex, FixedLengthListStats > rx;
+
+          void report( void ) {
+             FixedLengthListStatsSnapshot s = rx.stats();
+             printf( "peak %u/64, rejected %u\n",
+                     (unsigned)s.m_peakUsed, (unsigned)s.m_rejected );
+             rx.reset_stats();
+          }
+   \endcode
+*/
+class FixedLengthListStats
+{
+    public:
+        enum { enabled = 1 };
+
+        void stats_insert( const unsigned p_op, const size_t p_rejected, const size_t p_used ) const;
+        void stats_op( const unsigned p_op ) const;
+        void stats_scan( const size_t p_nodes ) const;
+        FixedLengthListStatsSnapshot stats_snapshot( void ) const;
+        void stats_reset( void );
+
+    private:
+        /** The counters.  Updated by const methods, as searches are */
+        mutable FixedLengthListStatsSnapshot m_stats;
+};
+
+inline FixedLengthListStatsSnapshot::FixedLengthListStatsSnapshot( void ) : m_peakUsed( 0U ), m_rejected( 0U )
+{
+    for( size_t i = 0;
+         i < OP_COUNT;
+         i++ )
+    {
+        m_ops[ i ] = 0U;
+    }
+
+    for( size_t i = 0;
+         i < SCAN_BUCKETS;
+         i++ )
+    {
+        m_scans[ i ] = 0U;
+    }
+}
+
+inline size_t FixedLengthListStatsSnapshot::scan_bucket( size_t p_nodes )
+{
+    size_t ret_val = 0U;
+
+    /* Bucket is the number of significant bits in p_nodes */
+    while( ( p_nodes != 0U ) && ( ret_val < ( SCAN_BUCKETS - 1U ) ) )
+    {
+        p_nodes >>= 1;
+        ret_val++;
+    }
+
+    return ret_val;
+}
+
+inline void FixedLengthListStats::stats_insert( const unsigned p_op, const size_t p_rejected, const size_t p_used ) const
+{
+    m_stats.m_ops[ p_op ]++;
+    m_stats.m_rejected += p_rejected;
+
+    if( p_used > m_stats.m_peakUsed )
+    {
+        m_stats.m_peakUsed = p_used;
+    }
+}
+
+inline void FixedLengthListStats::stats_op( const unsigned p_op ) const
+{
+    m_stats.m_ops[ p_op ]++;
+}
+
+inline void FixedLengthListStats::stats_scan( const size_t p_nodes ) const
+{
+    m_stats.m_scans[ FixedLengthListStatsSnapshot::scan_bucket( p_nodes ) ]++;
+}
+
+inline FixedLengthListStatsSnapshot FixedLengthListStats::stats_snapshot( void ) const
+{
+    return m_stats;
+}
+
+inline void FixedLengthListStats::stats_reset( void )
+{
+    m_stats = FixedLengthListStatsSnapshot();
+}
+
+#endif
@@ -0,0 +1,434 @@
+/**
+   @file
+   @brief Template class ( FixedLengthMPMCList ) to implement a lock-free
+          queue with a limited number of elements which may be shared between
+          any number of producer and consumer threads.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHMPMCLIST_HPP
+#define      FIXEDLENGTHMPMCLIST_HPP
+
+#include <cstddef> // for size_t
+#include <cstring> // for memcpy()
+#include <stdint.h> // for uint32_t, uint64_t
+#include <atomic>
+#include <type_traits>
+
+#ifndef FIXEDLENGTH_CACHE_LINE_SIZE
+/** Size of a cache line, used to keep data written by different threads
+    apart.  May be overridden to suit the target */
+#define FIXEDLENGTH_CACHE_LINE_SIZE (64U)
+#endif
+
+/**
+   Template class to implement a first-in, first-out queue with a fixed
+   maximum number of elements which may be used by any number of threads
+   concurrently, without locking.
+
+   The structure follows FixedLengthList: a pool of items, a stack of free
+   items and a linked list of used items.  Links are indices into the pool.
+   Every shared link (the free stack head, the used list head and tail and the
+   forward link within each item) is combined with a generation count into a
+   single 64-bit word which is updated with compare-and-swap.  The generation
+   is incremented on every update, so a thread which has been pre-empted
+   while an item is freed and re-used will fail its compare-and-swap rather
+   than corrupt the list (the ABA problem).
+
+   - Allocation and release of items is a Treiber stack.
+   - The used list is a Michael-Scott queue, which always contains one
+     "dummy" item ahead of the first real item.  The pool therefore holds
+     queueMax + 1 items.
+
+   As pop() must copy an item out before it knows whether it has won the race
+   to remove it, the item may be overwritten by another thread during the
+   copy (in which case the copy is discarded).  To keep this well defined,
+   T must be trivially copyable and is stored as an array of relaxed atomic
+   words.  Small types are best suited to this class; for large items,
+   consider queueing an index or pointer.
+
+   Only queue() (at the end of the list) and pop() (from the front of the
+   list) are provided.  used() and available() are maintained separately from
+   the list itself so only give a snapshot.
+
+   The class requires C++11 and a lock-free std::atomic<uint64_t>.
+
+   Example:
+   \code
+          #define LIST_LEN (256U)
+          FixedLengthMPMCList<int,  LIST_LEN > list;
+
+          // Any thread
+          void produce( int i ) {
+             while( !list.queue( i ) ) {
+                // List full
+             }
+          }
+
+          // Any thread
+          void consume( void ) {
+             int i;
+             if( list.pop( &i ) ) {
+                // Process i
+             }
+          }
+    \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthMPMCList
+{
+    /* Pointless to have a queue with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    static_assert( queueMax > 0, "Queue must have a non-zero length" );
+    /* Need to leave room for the dummy item and the "no item" index */
+    static_assert( queueMax < 0xFFFFFFFEUL, "Queue too long for 32-bit indices" );
+    static_assert( std::is_trivially_copyable<T>::value, "T must be trivially copyable" );
+
+    private:
+        /** Index value used to indicate the absence of an item */
+        static const uint32_t NIL = 0xFFFFFFFFUL;
+
+        /** Number of words used to store a T */
+        static const size_t WORDS = ( sizeof( T ) + sizeof( uint64_t ) - 1U ) / sizeof( uint64_t );
+
+        /** An item in the pool */
+        struct Item
+        {
+            /** Tagged index of the next item in the used list or free
+                stack */
+            std::atomic<uint64_t> m_forward;
+            /** The content/value of the item itself */
+            std::atomic<uint64_t> m_item[ WORDS ];
+        };
+
+        /** Combine an index and a generation count into a tagged link */
+        static uint64_t tag( const uint32_t p_index, const uint32_t p_gen );
+        /** Extract the index from a tagged link */
+        static uint32_t index( const uint64_t p_link );
+        /** Extract the generation count from a tagged link */
+        static uint32_t gen( const uint64_t p_link );
+
+        /** Pool of list items, including the dummy item */
+        Item                    m_items[ queueMax + 1U ];
+
+        /** Tagged link to the start of the stack of free items */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<uint64_t> m_freeHead;
+
+        /** Tagged link to the dummy item at the start of the used list */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<uint64_t> m_usedHead;
+
+        /** Tagged link to the last item (or one before it) in the used
+            list */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<uint64_t> m_usedTail;
+
+        /** Keep count of the number of used items on the list.  May
+            temporarily go negative, as a pop() may be counted before the
+            queue() which it removed */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<ptrdiff_t> m_usedCount;
+
+        /** Take an item from the free stack
+
+            \returns Index of the item, or NIL in the case that the stack is
+                     empty */
+        uint32_t alloc_node( void );
+
+        /** Return an item to the free stack */
+        void free_node( const uint32_t p_index );
+
+        /** Update the forward link of an item which is not visible to any other
+            thread, advancing the link's generation */
+        void set_forward( const uint32_t p_index, const uint32_t p_next );
+
+    public:
+        /** Constructor for FixedLengthMPMCList */
+        FixedLengthMPMCList( void );
+
+        FixedLengthMPMCList( const FixedLengthMPMCList& ) = delete;
+        FixedLengthMPMCList& operator=( const FixedLengthMPMCList& ) = delete;
+
+        /**
+           queue an item onto the end of the list
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool queue( const T& p_item );
+
+        /**
+           pop an item from the front of the list (item is removed and returned
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (list empty)
+        */
+        bool pop( T* const p_item );
+
+        /** Used to find out how many items are in the list
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the list
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax >
+const uint32_t FixedLengthMPMCList< T, queueMax >::NIL;
+
+template < class T, size_t queueMax >
+const size_t FixedLengthMPMCList< T, queueMax >::WORDS;
+
+template < class T, size_t queueMax >
+uint64_t FixedLengthMPMCList< T, queueMax >::tag( const uint32_t p_index, const uint32_t p_gen )
+{
+    return ( (uint64_t)p_gen << 32 ) | p_index;
+}
+
+template < class T, size_t queueMax >
+uint32_t FixedLengthMPMCList< T, queueMax >::index( const uint64_t p_link )
+{
+    return (uint32_t)p_link;
+}
+
+template < class T, size_t queueMax >
+uint32_t FixedLengthMPMCList< T, queueMax >::gen( const uint64_t p_link )
+{
+    return (uint32_t)( p_link >> 32 );
+}
+
+template < class T, size_t queueMax >
+FixedLengthMPMCList< T, queueMax >::FixedLengthMPMCList( void ) : m_usedCount( 0 )
+{
+    /* All but the last item go into the free stack */
+    for( uint32_t i = 0;
+         i < queueMax;
+         i++ )
+    {
+        m_items[ i ].m_forward.store( tag( ( i + 1U < queueMax ) ? ( i + 1U ) : NIL, 0U ), std::memory_order_relaxed );
+    }
+    m_freeHead.store( tag( 0U, 0U ), std::memory_order_relaxed );
+
+    /* The last item is the initial dummy at the start of the used list */
+    m_items[ queueMax ].m_forward.store( tag( NIL, 0U ), std::memory_order_relaxed );
+    m_usedHead.store( tag( queueMax, 0U ), std::memory_order_relaxed );
+    m_usedTail.store( tag( queueMax, 0U ), std::memory_order_relaxed );
+}
+
+template < class T, size_t queueMax >
+void FixedLengthMPMCList< T, queueMax >::set_forward( const uint32_t p_index, const uint32_t p_next )
+{
+    std::atomic<uint64_t>& forward = m_items[ p_index ].m_forward;
+    forward.store( tag( p_next, gen( forward.load( std::memory_order_relaxed ) ) + 1U ), std::memory_order_relaxed );
+}
+
+template < class T, size_t queueMax >
+uint32_t FixedLengthMPMCList< T, queueMax >::alloc_node( void )
+{
+    uint64_t head = m_freeHead.load( std::memory_order_acquire );
+
+    while( index( head ) != NIL )
+    {
+        /* The item may be taken (and its link changed) by another thread
+           before the CAS, in which case the generation of m_freeHead will
+           have moved on and the CAS will fail */
+        const uint64_t next = m_items[ index( head ) ].m_forward.load( std::memory_order_acquire );
+
+        if( m_freeHead.compare_exchange_weak( head, tag( index( next ), gen( head ) + 1U ),
+                                              std::memory_order_acquire,
+                                              std::memory_order_acquire ) )
+        {
+            break;
+        }
+    }
+
+    return index( head );
+}
+
+template < class T, size_t queueMax >
+void FixedLengthMPMCList< T, queueMax >::free_node( const uint32_t p_index )
+{
+    uint64_t head = m_freeHead.load( std::memory_order_relaxed );
+
+    do
+    {
+        set_forward( p_index, index( head ) );
+    } while( !m_freeHead.compare_exchange_weak( head, tag( p_index, gen( head ) + 1U ),
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed ) );
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthMPMCList< T, queueMax >::queue( const T& p_item )
+{
+    bool ret_val = false;
+    const uint32_t new_item = alloc_node();
+
+    /* Check that there's space in the list */
+    if( new_item != NIL )
+    {
+        uint64_t words[ WORDS ] = { 0 };
+        uint64_t tail;
+
+        /* Item isn't visible to other threads until it's linked, so can be
+           populated at leisure */
+        memcpy( words, &p_item, sizeof( T ) );
+        for( size_t w = 0; w < WORDS; w++ ) {
+            m_items[ new_item ].m_item[ w ].store( words[ w ], std::memory_order_relaxed );
+        }
+
+        /* Item is going at end of list - no forward link */
+        set_forward( new_item, NIL );
+
+        for( ;; )
+        {
+            tail = m_usedTail.load( std::memory_order_acquire );
+            uint64_t next = m_items[ index( tail ) ].m_forward.load( std::memory_order_acquire );
+
+            /* Check that the tail didn't move while the link was read */
+            if( tail == m_usedTail.load( std::memory_order_acquire ) )
+            {
+                if( index( next ) == NIL )
+                {
+                    /* Tail really is the last item - try to link the new item
+                       after it */
+                    if( m_items[ index( tail ) ].m_forward.compare_exchange_weak( next, tag( new_item, gen( next ) + 1U ),
+                                                                                  std::memory_order_release,
+                                                                                  std::memory_order_relaxed ) )
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    /* Another thread has linked an item but not yet updated
+                       the tail - help it along */
+                    m_usedTail.compare_exchange_weak( tail, tag( index( next ), gen( tail ) + 1U ),
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed );
+                }
+            }
+        }
+
+        /* Try to move the tail on to the new item.  If this fails another
+           thread has already done so */
+        m_usedTail.compare_exchange_strong( tail, tag( new_item, gen( tail ) + 1U ),
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed );
+
+        m_usedCount.fetch_add( 1, std::memory_order_relaxed );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthMPMCList< T, queueMax >::pop( T* const p_item )
+{
+    bool ret_val = false;
+    uint64_t words[ WORDS ];
+    uint64_t head;
+
+    for( ;; )
+    {
+        head = m_usedHead.load( std::memory_order_acquire );
+        uint64_t tail = m_usedTail.load( std::memory_order_acquire );
+        uint64_t next = m_items[ index( head ) ].m_forward.load( std::memory_order_acquire );
+
+        /* Check that the head didn't move while the others were read */
+        if( head == m_usedHead.load( std::memory_order_acquire ) )
+        {
+            if( index( head ) == index( tail ) )
+            {
+                if( index( next ) == NIL )
+                {
+                    /* List empty */
+                    break;
+                }
+
+                /* Another thread has linked an item but not yet updated the
+                   tail - help it along */
+                m_usedTail.compare_exchange_weak( tail, tag( index( next ), gen( tail ) + 1U ),
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed );
+            }
+            else
+            {
+                /* Copy the item out before trying to claim it, as once it's
+                   claimed another thread could free and re-use it */
+                for( size_t w = 0; w < WORDS; w++ ) {
+                    words[ w ] = m_items[ index( next ) ].m_item[ w ].load( std::memory_order_relaxed );
+                }
+
+                /* The next item becomes the new dummy */
+                if( m_usedHead.compare_exchange_weak( head, tag( index( next ), gen( head ) + 1U ),
+                                                      std::memory_order_acq_rel,
+                                                      std::memory_order_relaxed ) )
+                {
+                    ret_val = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if( ret_val )
+    {
+        memcpy( p_item, words, sizeof( T ) );
+
+        /* The old dummy can now be re-used */
+        free_node( index( head ) );
+
+        m_usedCount.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthMPMCList< T, queueMax >::used() const
+{
+    ptrdiff_t count = m_usedCount.load( std::memory_order_relaxed );
+    size_t ret_val = 0U;
+
+    if( count > 0 )
+    {
+        ret_val = ( (size_t)count < queueMax ) ? (size_t)count : queueMax;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthMPMCList< T, queueMax >::available() const
+{
+    return queueMax - used();
+}
+
+#endif
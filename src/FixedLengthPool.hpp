@@ -0,0 +1,821 @@
+/**
+   @file
+   @brief Template classes ( FixedLengthPool, FixedLengthPoolList ) to
+          implement any number of lists which share a single fixed size pool
+          of items.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHPOOL_HPP
+#define      FIXEDLENGTHPOOL_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <new> // for placement new
+
+#include "FixedLengthList.hpp"
+
+/**
+   Template class holding a fixed size pool of poolMax items, from which
+   any number of FixedLengthPoolList instances take their items.
+
+   The pool holds the items and their links (as determined by the Links
+   policy, see FixedLengthListLinks.hpp) along with the stack of free items,
+   exactly as FixedLengthList does, but leaves the lists of used items to
+   the FixedLengthPoolList instances.  The memory needed is therefore
+   bounded by the total number of items in all of the lists at any one
+   time, rather than each list having to be sized for its own worst case.
+
+   As with FixedLengthList, slots are only threaded onto the free stack as
+   they are needed, so constructing the pool is constant time.
+
+   allocate() and release() may also be used directly to obtain raw
+   (unconstructed) items from the pool.
+
+   The pool must outlive any lists using it.  Note that the class currently
+   is not thread safe.
+*/
+template < class T, size_t poolMax, template < class, size_t > class Links = FixedLengthListSingleLinks > class FixedLengthPool
+{
+    /* Pointless to have a pool with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    STATIC_ASSERT( poolMax > 0, Pool_must_have_a_non_zero_length );
+
+    public:
+        /** The link policy in use */
+        typedef Links< T, poolMax > links_t;
+
+        /** Type used by the link policy to refer to an item */
+        typedef typename links_t::link_t link_t;
+
+    private:
+        /** Pool of items, along with the links between them */
+        links_t                 m_items;
+
+        /** Link to the start of the stack of free items.  Will be nil in
+            the case that there are none (which does not mean that the pool
+            is exhausted, see m_highWater) */
+        link_t                  m_freeHead;
+
+        /** Number of slots which have been used since the pool was
+            constructed, as FixedLengthList */
+        size_t                  m_highWater;
+
+        /** Number of items allocated from the pool */
+        size_t                  m_usedCount;
+
+        /* Not copyable - lists refer to the pool's items */
+        FixedLengthPool( const FixedLengthPool& );
+        FixedLengthPool& operator=( const FixedLengthPool& );
+
+    public:
+        /** Constructor for FixedLengthPool */
+        FixedLengthPool( void );
+
+        /** Take an item from the pool.  The item is not constructed and its
+            links are undefined
+
+            \returns The item, or nil in the case that the pool is exhausted */
+        link_t allocate( void );
+
+        /** Return an item to the pool.  Any content must already have been
+            destroyed
+
+            \param p_item Item to be returned, which must have come from
+                          allocate() */
+        void release( const link_t p_item );
+
+        /** Return a run of items, which are already forward linked from
+            p_first to p_last, to the pool in one go
+
+            \param p_first First item in the run
+            \param p_last Last item in the run
+            \param p_count Number of items in the run */
+        void release_run( const link_t p_first, const link_t p_last, const size_t p_count );
+
+        /** Access the items and their links */
+        links_t& links( void );
+
+        /** Access the items and their links */
+        const links_t& links( void ) const;
+
+        /** Used to find out how many items have been allocated from the pool
+
+            \returns Number of used items, ranging from 0 to poolMax */
+        size_t used() const;
+
+        /** Used to find out how many items are still available in the pool
+
+            \returns Number of available items, ranging from 0 to poolMax */
+        size_t available() const;
+};
+
+/**
+   Template class to implement a list, as FixedLengthList, which takes its
+   items from a FixedLengthPool shared with other lists.  The list itself
+   holds only the head and tail of its items and a count of them.
+
+   As the items of every list using the same pool are held in the same
+   storage, moving items from one list to another (see splice_back()) is
+   purely a matter of relinking, with no items being copied.
+
+   Example:
+   \code
+          typedef FixedLengthPool< Packet, 1024 > packet_pool_t;
+          typedef FixedLengthPoolList< Packet, 1024 > packet_list_t;
+
+          packet_pool_t pool;
+
+          // Each connection's queue may hold anything up to all 1024
+          // packets, but between them they can't hold more than 1024
+          packet_list_t rx( pool );
+          packet_list_t tx( pool );
+
+          void forward( void ) {
+             // Moves all of the packets, without copying any of them
+             tx.splice_back( rx );
+          }
+   \endcode
+*/
+template < class T, size_t poolMax, template < class, size_t > class Links = FixedLengthListSingleLinks > class FixedLengthPoolList
+{
+    public:
+        /** Type of pool from which the list takes its items */
+        typedef FixedLengthPool< T, poolMax, Links > pool_t;
+
+    private:
+        /** The link policy in use */
+        typedef typename pool_t::links_t links_t;
+
+        /** Type used by the link policy to refer to an item */
+        typedef typename pool_t::link_t link_t;
+
+        /** Pool from which items are taken */
+        pool_t*                 m_pool;
+
+        /** Link to the first item in the list.  Will be nil in the case that
+            the list is empty */
+        link_t                  m_usedHead;
+
+        /** Link to the last item in the list.  Will be nil in the case that
+            the list is empty */
+        link_t                  m_usedTail;
+
+        /** Number of items in the list */
+        size_t                  m_usedCount;
+
+        /** Find the item preceding the specified item in the list, as
+            FixedLengthList */
+        link_t prev_node( const link_t p_item ) const;
+
+        /** Remove the specified item from the list, destroy it and return
+            it to the pool, as FixedLengthList */
+        void remove_node( const link_t p_item, const link_t p_prev );
+
+        /** Link a newly constructed item in at the start of the list */
+        void link_front( const link_t p_item );
+
+        /** Link a newly constructed item in at the end of the list */
+        void link_back( const link_t p_item );
+
+        /* Not copyable - use splice_back() to move items between lists */
+        FixedLengthPoolList( const FixedLengthPoolList& );
+        FixedLengthPoolList& operator=( const FixedLengthPoolList& );
+
+    public:
+        /** Constructor for FixedLengthPoolList
+
+            \param p_pool Pool from which to take items.  Must outlive the
+                          list */
+        FixedLengthPoolList( pool_t& p_pool );
+
+        /** Destructor for FixedLengthPoolList.  Destroys any items in the
+            list, returning them to the pool */
+        ~FixedLengthPoolList( void );
+
+        /**
+           push an item onto the front of the list
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (pool
+                    exhausted) */
+        bool push( const T& p_item );
+
+        /**
+           queue an item onto the end of the list
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (pool
+                    exhausted) */
+        bool queue( const T& p_item );
+
+#if FIXEDLENGTHLIST_CXX11
+        /**
+           push an item onto the front of the list, moving it into place
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (pool
+                    exhausted) */
+        bool push( T&& p_item );
+
+        /**
+           queue an item onto the end of the list, moving it into place
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (pool
+                    exhausted) */
+        bool queue( T&& p_item );
+#endif
+
+        /**
+           pop an item from the front of the list (item is removed and
+           returned)
+
+           \param p_item Pointer to be populated with the value of the item.
+                         The item is moved out of the list where supported
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (list empty)
+        */
+        bool pop( T* const p_item );
+
+        /**
+           dequeue an item from the end of the list (item is removed and
+           returned)
+
+           Constant time with a doubly linked policy, otherwise linear in the
+           number of items in the list.
+
+           \param p_item Pointer to be populated with the value of the item.
+                         The item is moved out of the list where supported
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (list empty)
+        */
+        bool dequeue( T* const p_item );
+
+        /**
+           remove the first item in the list which matches the specified item
+
+           \param p_item Item to be matched against
+           \returns true in the case that an item was removed
+                    false in the case that no matching item was found
+        */
+        bool remove( const T& p_item );
+
+        /** Determine whether or not a particular item is in the list
+
+            \param p_val Item to be matched against
+            \returns true in the case that the item is found in the list
+                     false in the case that it is not found in the list
+        */
+        bool inList( const T& p_val ) const;
+
+        /**
+           move up to p_count items from the front of p_other onto the end of
+           this list, keeping their order.  The items are relinked rather
+           than copied.  Linear in the number of items moved, other than
+           when moving all of p_other's items, which is constant time.
+
+           \param p_other List to take the items from.  Must use the same
+                          pool as this list, otherwise no items are moved.
+                          Splicing a list onto itself has no effect
+           \param p_count Maximum number of items to move
+           \returns Number of items moved
+        */
+        size_t splice_back( FixedLengthPoolList& p_other, const size_t p_count );
+
+        /**
+           move all of the items from p_other onto the end of this list,
+           keeping their order.  Constant time
+
+           \param p_other List to take the items from.  Must use the same
+                          pool as this list, otherwise no items are moved
+           \returns Number of items moved
+        */
+        size_t splice_back( FixedLengthPoolList& p_other );
+
+        /** Used to find out how many items are in the list
+
+            \returns Number of used items, ranging from 0 to poolMax */
+        size_t used() const;
+
+        /** Used to find out how many more items may be added to the list.
+            This is shared with all other lists using the same pool
+
+            \returns Number of available items in the pool, ranging from 0 to
+                     poolMax */
+        size_t available() const;
+
+        /** Remove (and destroy) the entire contents of the list, returning
+            the items to the pool */
+        void clear( void );
+
+        /** Access the pool from which the list takes its items */
+        pool_t& pool( void );
+
+        typedef FixedLengthListIter<T, poolMax, Links> iterator;
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+
+        iterator begin( void );
+        iterator end( void );
+};
+
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+FixedLengthPool< T, poolMax, Links >::FixedLengthPool( void ) : m_freeHead( links_t::nil() ), m_highWater( 0U ), m_usedCount( 0U )
+{
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+typename FixedLengthPool< T, poolMax, Links >::link_t FixedLengthPool< T, poolMax, Links >::allocate( void )
+{
+    link_t ret_val = m_freeHead;
+
+    /* Prefer items from the free stack, as they have been used recently so
+       are more likely to be in the cache */
+    if( ret_val != links_t::nil() )
+    {
+        m_freeHead = m_items.next( ret_val );
+        m_usedCount++;
+    }
+    else if( m_highWater < poolMax )
+    {
+        ret_val = m_items.slot( m_highWater++ );
+        m_usedCount++;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+void FixedLengthPool< T, poolMax, Links >::release( const link_t p_item )
+{
+    m_items.set_next( p_item, m_freeHead );
+    m_freeHead = p_item;
+    m_usedCount--;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+void FixedLengthPool< T, poolMax, Links >::release_run( const link_t p_first, const link_t p_last, const size_t p_count )
+{
+    m_items.set_next( p_last, m_freeHead );
+    m_freeHead = p_first;
+    m_usedCount -= p_count;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+typename FixedLengthPool< T, poolMax, Links >::links_t& FixedLengthPool< T, poolMax, Links >::links( void )
+{
+    return m_items;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+const typename FixedLengthPool< T, poolMax, Links >::links_t& FixedLengthPool< T, poolMax, Links >::links( void ) const
+{
+    return m_items;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+size_t FixedLengthPool< T, poolMax, Links >::used() const
+{
+    return m_usedCount;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+size_t FixedLengthPool< T, poolMax, Links >::available() const
+{
+    return poolMax - m_usedCount;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+FixedLengthPoolList< T, poolMax, Links >::FixedLengthPoolList( pool_t& p_pool ) : m_pool( &p_pool ),
+                                                                                 m_usedHead( links_t::nil() ),
+                                                                                 m_usedTail( links_t::nil() ),
+                                                                                 m_usedCount( 0U )
+{
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+FixedLengthPoolList< T, poolMax, Links >::~FixedLengthPoolList( void )
+{
+    clear();
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+void FixedLengthPoolList< T, poolMax, Links >::link_front( const link_t p_item )
+{
+    links_t& items = m_pool->links();
+
+    items.set_next( p_item, m_usedHead );
+    items.set_prev( p_item, links_t::nil() );
+
+    /* Update the current head item, if exists, otherwise this is the only
+       item so is also the tail */
+    if( m_usedHead != links_t::nil() )
+    {
+        items.set_prev( m_usedHead, p_item );
+    }
+    else
+    {
+        m_usedTail = p_item;
+    }
+
+    m_usedHead = p_item;
+    m_usedCount++;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+void FixedLengthPoolList< T, poolMax, Links >::link_back( const link_t p_item )
+{
+    links_t& items = m_pool->links();
+
+    /* Item is going at end of list - no forward link */
+    items.set_next( p_item, links_t::nil() );
+    items.set_prev( p_item, m_usedTail );
+
+    /* Update the current tail item, if exists */
+    if( m_usedTail != links_t::nil() )
+    {
+        items.set_next( m_usedTail, p_item );
+    }
+    else
+    {
+        m_usedHead = p_item;
+    }
+
+    m_usedTail = p_item;
+    m_usedCount++;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::push( const T& p_item )
+{
+    bool ret_val = false;
+    link_t new_item = m_pool->allocate();
+
+    if( new_item != links_t::nil() )
+    {
+        ::new( static_cast<void*>( &( m_pool->links().item( new_item ) ) ) ) T( p_item );
+        link_front( new_item );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::queue( const T& p_item )
+{
+    bool ret_val = false;
+    link_t new_item = m_pool->allocate();
+
+    if( new_item != links_t::nil() )
+    {
+        ::new( static_cast<void*>( &( m_pool->links().item( new_item ) ) ) ) T( p_item );
+        link_back( new_item );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+#if FIXEDLENGTHLIST_CXX11
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::push( T&& p_item )
+{
+    bool ret_val = false;
+    link_t new_item = m_pool->allocate();
+
+    if( new_item != links_t::nil() )
+    {
+        ::new( static_cast<void*>( &( m_pool->links().item( new_item ) ) ) ) T( std::move( p_item ) );
+        link_front( new_item );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::queue( T&& p_item )
+{
+    bool ret_val = false;
+    link_t new_item = m_pool->allocate();
+
+    if( new_item != links_t::nil() )
+    {
+        ::new( static_cast<void*>( &( m_pool->links().item( new_item ) ) ) ) T( std::move( p_item ) );
+        link_back( new_item );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+#endif
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::pop( T* const p_item )
+{
+    bool ret_val = false;
+
+    if( m_usedHead != links_t::nil() )
+    {
+        link_t old_item = m_usedHead;
+
+        *p_item = FIXEDLENGTHLIST_MOVE( m_pool->links().item( old_item ) );
+
+        remove_node( old_item, links_t::nil() );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::dequeue( T* const p_item )
+{
+    bool ret_val = false;
+
+    if( m_usedTail != links_t::nil() )
+    {
+        link_t old_item = m_usedTail;
+
+        *p_item = FIXEDLENGTHLIST_MOVE( m_pool->links().item( old_item ) );
+
+        remove_node( old_item, prev_node( old_item ) );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+typename FixedLengthPoolList< T, poolMax, Links >::link_t FixedLengthPoolList< T, poolMax, Links >::prev_node( const link_t p_item ) const
+{
+    const links_t& items = m_pool->links();
+    link_t ret_val = links_t::nil();
+
+    if( links_t::doubly_linked )
+    {
+        ret_val = items.prev( p_item );
+    }
+    else if( m_usedHead != p_item )
+    {
+        link_t p = m_usedHead;
+
+        /* No backward links, so iterate the list and find the item which
+           has p_item as its forward link */
+        while( items.next( p ) != p_item )
+        {
+            p = items.next( p );
+        }
+
+        ret_val = p;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+void FixedLengthPoolList< T, poolMax, Links >::remove_node( const link_t p_item, const link_t p_prev )
+{
+    links_t& items = m_pool->links();
+    link_t next = items.next( p_item );
+
+    /* If there was no previous item then this must be the head, so update
+       the head pointer, otherwise update the forward pointer on the
+       preceding item in the list */
+    if( p_prev == links_t::nil() )
+    {
+        m_usedHead = next;
+    }
+    else
+    {
+        items.set_next( p_prev, next );
+    }
+
+    /* Likewise, if there's no next item this must be the tail, otherwise
+       update the backward pointer on the following item in the list */
+    if( next == links_t::nil() )
+    {
+        m_usedTail = p_prev;
+    }
+    else
+    {
+        items.set_prev( next, p_prev );
+    }
+
+    /* Item is no longer in use - destroy it and return it to the pool */
+    items.item( p_item ).~T();
+    m_pool->release( p_item );
+
+    m_usedCount--;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::remove( const T& p_item )
+{
+    const links_t& items = m_pool->links();
+    bool ret_val = false;
+    link_t last = links_t::nil();
+    link_t p = m_usedHead;
+
+    /* Run through all the items in the list */
+    while( p != links_t::nil() )
+    {
+        /* Does the item match the one we're looking for? */
+        if( items.item( p ) == p_item )
+        {
+            remove_node( p, last );
+
+            ret_val = true;
+            break;
+        }
+        else
+        {
+            last = p;
+            p = items.next( p );
+        }
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+bool FixedLengthPoolList< T, poolMax, Links >::inList( const T& p_val ) const
+{
+    const links_t& items = m_pool->links();
+    bool ret_val = false;
+
+    for( link_t p = m_usedHead;
+         p != links_t::nil();
+         p = items.next( p ) )
+    {
+        if( items.item( p ) == p_val )
+        {
+            ret_val = true;
+            break;
+        }
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+size_t FixedLengthPoolList< T, poolMax, Links >::splice_back( FixedLengthPoolList& p_other, const size_t p_count )
+{
+    links_t& items = m_pool->links();
+    size_t count = 0U;
+
+    if( ( &p_other != this ) && ( p_other.m_pool == m_pool ) )
+    {
+        count = ( p_count < p_other.m_usedCount ) ? p_count : p_other.m_usedCount;
+    }
+
+    if( count > 0U )
+    {
+        link_t first = p_other.m_usedHead;
+        link_t last = p_other.m_usedTail;
+
+        /* Find the end of the run, unless it's the whole list */
+        if( count < p_other.m_usedCount )
+        {
+            last = first;
+            for( size_t i = 1U;
+                 i < count;
+                 i++ )
+            {
+                last = items.next( last );
+            }
+        }
+
+        /* Detach the run from the front of p_other */
+        p_other.m_usedHead = items.next( last );
+        if( p_other.m_usedHead == links_t::nil() )
+        {
+            p_other.m_usedTail = links_t::nil();
+        }
+        else
+        {
+            items.set_prev( p_other.m_usedHead, links_t::nil() );
+        }
+        p_other.m_usedCount -= count;
+
+        /* ... and attach it to the end of this list */
+        items.set_next( last, links_t::nil() );
+        items.set_prev( first, m_usedTail );
+        if( m_usedTail != links_t::nil() )
+        {
+            items.set_next( m_usedTail, first );
+        }
+        else
+        {
+            m_usedHead = first;
+        }
+        m_usedTail = last;
+        m_usedCount += count;
+    }
+
+    return count;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+size_t FixedLengthPoolList< T, poolMax, Links >::splice_back( FixedLengthPoolList& p_other )
+{
+    return splice_back( p_other, p_other.m_usedCount );
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+size_t FixedLengthPoolList< T, poolMax, Links >::used() const
+{
+    return m_usedCount;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+size_t FixedLengthPoolList< T, poolMax, Links >::available() const
+{
+    return m_pool->available();
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+void FixedLengthPoolList< T, poolMax, Links >::clear( void )
+{
+    links_t& items = m_pool->links();
+
+    if( m_usedHead != links_t::nil() )
+    {
+        /* Constant condition - the loop is dropped for types with no
+           destructor */
+        if( !FIXEDLENGTHLIST_TRIVIALLY_DESTRUCTIBLE( T ) )
+        {
+            for( link_t p = m_usedHead;
+                 p != links_t::nil();
+                 p = items.next( p ) )
+            {
+                items.item( p ).~T();
+            }
+        }
+
+        /* The list is already forward linked, so can go back to the pool
+           as-is */
+        m_pool->release_run( m_usedHead, m_usedTail, m_usedCount );
+    }
+
+    m_usedHead = links_t::nil();
+    m_usedTail = links_t::nil();
+    m_usedCount = 0U;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+typename FixedLengthPoolList< T, poolMax, Links >::pool_t& FixedLengthPoolList< T, poolMax, Links >::pool( void )
+{
+    return *m_pool;
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+FixedLengthListIter<T, poolMax, Links> FixedLengthPoolList< T, poolMax, Links >::begin( void )
+{
+    return iterator( &( m_pool->links() ), m_usedHead, &m_usedTail );
+}
+
+template < class T, size_t poolMax, template < class, size_t > class Links >
+FixedLengthListIter<T, poolMax, Links> FixedLengthPoolList< T, poolMax, Links >::end( void )
+{
+    return iterator( &( m_pool->links() ), links_t::nil(), &m_usedTail );
+}
+
+#endif
@@ -0,0 +1,655 @@
+/**
+   @file
+   @brief Template class ( FixedLengthPriorityQueue ) to implement a priority
+          queue with a limited number of elements, with stable handles to
+          allow items to be re-prioritised or removed.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHPRIORITYQUEUE_HPP
+#define      FIXEDLENGTHPRIORITYQUEUE_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <functional> // for less
+#include <new> // for placement new
+
+#include "FixedLengthListLinks.hpp"
+
+/**
+   Template class to implement a priority queue with a fixed maximum number
+   of elements.  pop() always yields the item which comes first according to
+   Compare - with the default of std::less, that is the smallest item.
+
+   Items are held in an implicit heap in a contiguous array, each item
+   having arity children.  push() and pop() are therefore O(log n), while
+   peeking at the first item is constant time.  A larger arity makes the
+   heap shallower, which favours push() and update() towards the front of
+   the queue, at the cost of more comparisons per level in pop().
+
+   Each item is given a handle when it is pushed, which remains valid until
+   the item leaves the queue (via pop() or remove()), however the item moves
+   around within the heap.  A handle may be used to change the item's value
+   (and therefore its priority, e.g. decrease-key) or remove it from the
+   queue, both O(log n).  Handles are recycled once the item has left the
+   queue, so must not be used after that point.
+
+   Handles are tracked without any additional storage for free handles:
+   positions in the heap beyond the last item hold the handles which are not
+   in use.  As with FixedLengthList, these are set up lazily, so
+   construction and clear() do not depend on queueMax.
+
+   As with FixedLengthList, items are only constructed while in the queue,
+   so T need not be default constructible.  T must be copy (or, with C++11,
+   move) constructible and assignable.
+
+   Note that the class currently is not thread safe.
+
+   Example:
+   \code
+          #define QUEUE_LEN (16U)
+          FixedLengthPriorityQueue< unsigned, QUEUE_LEN > deadlines;
+
+          int main( void ) {
+             FixedLengthPriorityQueue< unsigned, QUEUE_LEN >::handle_t h;
+             unsigned d;
+
+             deadlines.push( 300 );
+             deadlines.push( 200, &h );
+             deadlines.push( 100 );
+
+             deadlines.update( h, 50 );
+             // Queue now contains 50, 100, 300
+
+             deadlines.pop( &d );
+             // d == 50
+
+             return 0;
+          }
+    \endcode
+*/
+template < class T, size_t queueMax, class Compare = std::less< T >, size_t arity = 2U > class FixedLengthPriorityQueue
+{
+    /* Pointless to have a queue with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    STATIC_ASSERT( queueMax > 0, Queue_must_have_a_non_zero_length );
+    STATIC_ASSERT( arity >= 2, Heap_must_have_an_arity_of_at_least_two );
+
+    public:
+        /** Type used to refer to an item while it's in the queue */
+        typedef typename FixedLengthListIndex< queueMax >::type handle_t;
+
+        /** Handle value which never refers to an item */
+        static handle_t nil( void ) { return (handle_t)~(handle_t)0U; }
+
+    private:
+        /** Items, in heap order.  The first m_usedCount are constructed */
+        FixedLengthListSlot<T> m_items[ queueMax ];
+
+        /** Handle of the item at each position in the heap.  Positions from
+            m_usedCount up to m_highWater hold the handles not in use */
+        handle_t               m_handle[ queueMax ];
+
+        /** Position in the heap of the item with each handle, nil if the
+            handle is not in use.  Only valid for handles below m_highWater */
+        handle_t               m_pos[ queueMax ];
+
+        /** Number of items in the queue */
+        size_t                 m_usedCount;
+
+        /** Number of handles which have been set up since the queue was
+            constructed */
+        size_t                 m_highWater;
+
+        /** Item ordering */
+        Compare                m_compare;
+
+        /** Access the item at a position in the heap */
+        T& item( const size_t p_pos ) { return m_items[ p_pos ].value(); }
+
+        /** Access the item at a position in the heap */
+        const T& item( const size_t p_pos ) const { return m_items[ p_pos ].value(); }
+
+        /** Handle for the item about to be added at position m_usedCount */
+        handle_t free_handle( void );
+
+        /** Place an item at a position in the heap, updating the handle
+            tracking */
+        void place( const size_t p_pos, const handle_t p_handle );
+
+        /** Move the item at p_pos towards the root until it is in order */
+        void sift_up( size_t p_pos );
+
+        /** Move the item at p_pos away from the root until it is in order */
+        void sift_down( size_t p_pos );
+
+        /** Link a newly constructed item at position m_usedCount into the
+            heap
+
+            \returns The item's handle */
+        handle_t link_new( void );
+
+        /** Restore heap order after the item at p_pos has been changed */
+        void sift( const size_t p_pos );
+
+        /** Remove the item at p_pos, which must be constructed */
+        void remove_at( const size_t p_pos );
+
+        /** Copy the items and handles from another queue.  This queue must
+            be empty */
+        void copy_from( const FixedLengthPriorityQueue& p_other );
+
+    public:
+        /** Constructor for FixedLengthPriorityQueue */
+        FixedLengthPriorityQueue( const Compare& p_compare = Compare() );
+
+        /** Copy constructor for FixedLengthPriorityQueue.  Handles for the
+            items remain valid for the copy */
+        FixedLengthPriorityQueue( const FixedLengthPriorityQueue& p_other );
+
+        /** Destructor for FixedLengthPriorityQueue.  Destroys any items in
+            the queue */
+        ~FixedLengthPriorityQueue( void );
+
+        /** Assignment operator for FixedLengthPriorityQueue.  Handles for
+            the items remain valid for the copy */
+        FixedLengthPriorityQueue& operator=( const FixedLengthPriorityQueue& p_other );
+
+        /**
+           push an item into the queue
+
+           \param p_item The item to be added to the queue
+           \param p_handle Pointer to be populated with the item's handle, may
+                           be NULL in the case that the handle isn't needed
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool push( const T& p_item, handle_t* const p_handle = NULL );
+
+#if FIXEDLENGTHLIST_CXX11
+        /**
+           push an item into the queue, moving it into place
+
+           \param p_item The item to be added to the queue
+           \param p_handle Pointer to be populated with the item's handle, may
+                           be NULL in the case that the handle isn't needed
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool push( T&& p_item, handle_t* const p_handle = NULL );
+#endif
+
+        /**
+           pop the first item from the queue (item is removed and returned)
+
+           \param p_item Pointer to be populated with the value of the item.
+                         The item is moved out of the queue where supported
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (queue
+                    empty)
+        */
+        bool pop( T* const p_item );
+
+        /**
+           retrieve the first item in the queue, leaving it in the queue
+
+           \param p_item Pointer to be populated with the value of the item
+           \param p_handle Pointer to be populated with the item's handle, may
+                           be NULL in the case that the handle isn't needed
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (queue
+                    empty)
+        */
+        bool peek( T* const p_item, handle_t* const p_handle = NULL ) const;
+
+        /**
+           change the value of an item in the queue, moving it to the correct
+           position for its new priority
+
+           \param p_handle Handle of the item to change
+           \param p_item New value for the item
+           \returns true in the case that the item was updated
+                    false in the case that p_handle is not in use
+        */
+        bool update( const handle_t p_handle, const T& p_item );
+
+        /**
+           remove an item from the queue, wherever it is
+
+           \param p_handle Handle of the item to remove
+           \param p_item Pointer to be populated with the value of the item,
+                         may be NULL in the case that it isn't needed
+           \returns true in the case that the item was removed
+                    false in the case that p_handle is not in use
+        */
+        bool remove( const handle_t p_handle, T* const p_item = NULL );
+
+        /** Determine whether or not a handle refers to an item in the queue
+
+            \param p_handle Handle to check
+            \returns true in the case that the handle is in use */
+        bool contains( const handle_t p_handle ) const;
+
+        /** Access the item referred to by a handle.  Note that the item must
+            not be modified in a way which changes its priority - use
+            update() for that
+
+            \param p_handle Handle of the item, which must be in use (see
+                            contains()).  Passing a handle which is not in use
+                            (including nil()) is undefined */
+        const T& operator[]( const handle_t p_handle ) const;
+
+        /** Used to find out how many items are in the queue
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the queue
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        /** Remove (and destroy) the entire contents of the queue and return it
+            back to an empty state */
+        void clear( void );
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+FixedLengthPriorityQueue< T, queueMax, Compare, arity >::FixedLengthPriorityQueue( const Compare& p_compare ) : m_usedCount( 0U ), m_highWater( 0U ), m_compare( p_compare )
+{
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+FixedLengthPriorityQueue< T, queueMax, Compare, arity >::FixedLengthPriorityQueue( const FixedLengthPriorityQueue& p_other ) : m_usedCount( 0U ), m_highWater( 0U ), m_compare( p_other.m_compare )
+{
+    copy_from( p_other );
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+FixedLengthPriorityQueue< T, queueMax, Compare, arity >::~FixedLengthPriorityQueue( void )
+{
+    clear();
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+FixedLengthPriorityQueue< T, queueMax, Compare, arity >& FixedLengthPriorityQueue< T, queueMax, Compare, arity >::operator=( const FixedLengthPriorityQueue& p_other )
+{
+    if( this != &p_other )
+    {
+        clear();
+        m_compare = p_other.m_compare;
+        copy_from( p_other );
+    }
+
+    return *this;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::copy_from( const FixedLengthPriorityQueue& p_other )
+{
+    for( size_t i = 0;
+         i < p_other.m_usedCount;
+         i++ )
+    {
+        ::new( static_cast<void*>( &( item( i ) ) ) ) T( p_other.item( i ) );
+        m_usedCount++;
+    }
+
+    for( size_t i = 0;
+         i < p_other.m_highWater;
+         i++ )
+    {
+        m_handle[ i ] = p_other.m_handle[ i ];
+        m_pos[ i ] = p_other.m_pos[ i ];
+    }
+
+    m_highWater = p_other.m_highWater;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+typename FixedLengthPriorityQueue< T, queueMax, Compare, arity >::handle_t FixedLengthPriorityQueue< T, queueMax, Compare, arity >::free_handle( void )
+{
+    /* All handles below the high water mark are either in use or parked
+       beyond the end of the heap, so if the heap has reached the mark a new
+       handle is needed */
+    if( m_usedCount == m_highWater )
+    {
+        m_handle[ m_highWater ] = (handle_t)m_highWater;
+        m_highWater++;
+    }
+
+    return m_handle[ m_usedCount ];
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::place( const size_t p_pos, const handle_t p_handle )
+{
+    m_handle[ p_pos ] = p_handle;
+    m_pos[ p_handle ] = (handle_t)p_pos;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::sift_up( size_t p_pos )
+{
+    if( ( p_pos > 0U ) && m_compare( item( p_pos ), item( ( p_pos - 1U ) / arity ) ) )
+    {
+        /* Lift the item out, leaving a hole which is moved up the heap
+           until the item's place is found, rather than swapping at each
+           level */
+        T moving( FIXEDLENGTHLIST_MOVE( item( p_pos ) ) );
+        handle_t handle = m_handle[ p_pos ];
+
+        do
+        {
+            size_t parent = ( p_pos - 1U ) / arity;
+
+            item( p_pos ) = FIXEDLENGTHLIST_MOVE( item( parent ) );
+            place( p_pos, m_handle[ parent ] );
+            p_pos = parent;
+        } while( ( p_pos > 0U ) && m_compare( moving, item( ( p_pos - 1U ) / arity ) ) );
+
+        item( p_pos ) = FIXEDLENGTHLIST_MOVE( moving );
+        place( p_pos, handle );
+    }
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::sift_down( size_t p_pos )
+{
+    T* moving = NULL;
+    handle_t handle = m_handle[ p_pos ];
+
+    /* Slot for the lifted item, constructed only if it needs to move */
+    FixedLengthListSlot<T> held;
+
+    for( ;; )
+    {
+        size_t first = ( p_pos * arity ) + 1U;
+        size_t best = first;
+        const T& current = ( moving != NULL ) ? *moving : item( p_pos );
+
+        if( first >= m_usedCount )
+        {
+            break;
+        }
+
+        /* Find the child which comes first */
+        for( size_t c = first + 1U;
+             ( c < ( first + arity ) ) && ( c < m_usedCount );
+             c++ )
+        {
+            if( m_compare( item( c ), item( best ) ) )
+            {
+                best = c;
+            }
+        }
+
+        if( !m_compare( item( best ), current ) )
+        {
+            break;
+        }
+
+        /* Lift the item out on the first move, leaving a hole to move down
+           the heap */
+        if( moving == NULL )
+        {
+            moving = ::new( static_cast<void*>( &( held.value() ) ) ) T( FIXEDLENGTHLIST_MOVE( item( p_pos ) ) );
+        }
+
+        item( p_pos ) = FIXEDLENGTHLIST_MOVE( item( best ) );
+        place( p_pos, m_handle[ best ] );
+        p_pos = best;
+    }
+
+    if( moving != NULL )
+    {
+        item( p_pos ) = FIXEDLENGTHLIST_MOVE( *moving );
+        place( p_pos, handle );
+        moving->~T();
+    }
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::sift( const size_t p_pos )
+{
+    if( ( p_pos > 0U ) && m_compare( item( p_pos ), item( ( p_pos - 1U ) / arity ) ) )
+    {
+        sift_up( p_pos );
+    }
+    else
+    {
+        sift_down( p_pos );
+    }
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::remove_at( const size_t p_pos )
+{
+    handle_t handle = m_handle[ p_pos ];
+    size_t last = m_usedCount - 1U;
+
+    m_pos[ handle ] = nil();
+
+    /* Fill the hole with the last item, then park the removed item's handle
+       at the end of the heap, where the next push() will pick it up */
+    if( p_pos != last )
+    {
+        item( p_pos ) = FIXEDLENGTHLIST_MOVE( item( last ) );
+        place( p_pos, m_handle[ last ] );
+    }
+
+    item( last ).~T();
+    m_handle[ last ] = handle;
+    m_usedCount--;
+
+    if( p_pos < m_usedCount )
+    {
+        sift( p_pos );
+    }
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::push( const T& p_item, handle_t* const p_handle )
+{
+    bool ret_val = false;
+
+    /* Check that there's space in the queue */
+    if( m_usedCount < queueMax )
+    {
+        ::new( static_cast<void*>( &( item( m_usedCount ) ) ) ) T( p_item );
+
+        handle_t handle = link_new();
+
+        if( p_handle != NULL )
+        {
+            *p_handle = handle;
+        }
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+#if FIXEDLENGTHLIST_CXX11
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::push( T&& p_item, handle_t* const p_handle )
+{
+    bool ret_val = false;
+
+    /* Check that there's space in the queue */
+    if( m_usedCount < queueMax )
+    {
+        ::new( static_cast<void*>( &( item( m_usedCount ) ) ) ) T( std::move( p_item ) );
+
+        handle_t handle = link_new();
+
+        if( p_handle != NULL )
+        {
+            *p_handle = handle;
+        }
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+#endif
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+typename FixedLengthPriorityQueue< T, queueMax, Compare, arity >::handle_t FixedLengthPriorityQueue< T, queueMax, Compare, arity >::link_new( void )
+{
+    handle_t handle = free_handle();
+
+    place( m_usedCount, handle );
+    m_usedCount++;
+
+    sift_up( m_usedCount - 1U );
+
+    return handle;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::pop( T* const p_item )
+{
+    bool ret_val = false;
+
+    if( m_usedCount > 0U )
+    {
+        *p_item = FIXEDLENGTHLIST_MOVE( item( 0U ) );
+
+        remove_at( 0U );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::peek( T* const p_item, handle_t* const p_handle ) const
+{
+    bool ret_val = false;
+
+    if( m_usedCount > 0U )
+    {
+        *p_item = item( 0U );
+
+        if( p_handle != NULL )
+        {
+            *p_handle = m_handle[ 0U ];
+        }
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::update( const handle_t p_handle, const T& p_item )
+{
+    bool ret_val = false;
+
+    if( contains( p_handle ) )
+    {
+        size_t pos = m_pos[ p_handle ];
+
+        item( pos ) = p_item;
+        sift( pos );
+
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::remove( const handle_t p_handle, T* const p_item )
+{
+    bool ret_val = false;
+
+    if( contains( p_handle ) )
+    {
+        size_t pos = m_pos[ p_handle ];
+
+        if( p_item != NULL )
+        {
+            *p_item = FIXEDLENGTHLIST_MOVE( item( pos ) );
+        }
+
+        remove_at( pos );
+
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+bool FixedLengthPriorityQueue< T, queueMax, Compare, arity >::contains( const handle_t p_handle ) const
+{
+    /* m_highWater never exceeds queueMax, but checking queueMax as well
+       makes the bound of m_pos plain to the compiler */
+    return ( p_handle < queueMax ) && ( p_handle < m_highWater ) && ( m_pos[ p_handle ] != nil() );
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+const T& FixedLengthPriorityQueue< T, queueMax, Compare, arity >::operator[]( const handle_t p_handle ) const
+{
+    return item( m_pos[ p_handle ] );
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+size_t FixedLengthPriorityQueue< T, queueMax, Compare, arity >::used() const
+{
+    return m_usedCount;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+size_t FixedLengthPriorityQueue< T, queueMax, Compare, arity >::available() const
+{
+    return queueMax - m_usedCount;
+}
+
+template < class T, size_t queueMax, class Compare, size_t arity >
+void FixedLengthPriorityQueue< T, queueMax, Compare, arity >::clear( void )
+{
+    /* Handles stay where they are, the ones in use simply being marked as
+       free */
+    for( size_t i = 0;
+         i < m_usedCount;
+         i++ )
+    {
+        m_pos[ m_handle[ i ] ] = nil();
+        item( i ).~T();
+    }
+
+    m_usedCount = 0U;
+}
+
+#endif
@@ -0,0 +1,546 @@
+/**
+   @file
+   @brief Template class ( FixedLengthRing ) to implement a double-ended queue
+          with a limited number of elements, stored contiguously.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHRING_HPP
+#define      FIXEDLENGTHRING_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <algorithm> // for min()
+
+#ifndef STATIC_ASSERT
+/** Emulation of C++11's static_assert */
+#define STATIC_ASSERT( condition, name ) typedef char assert_failed_ ## name [ (condition) ? 1 : -1 ]
+#endif
+
+template < class T, size_t queueMax > class FixedLengthRing;
+
+/**
+    Iterator support class for FixedLengthRing
+
+   Example:
+   \code
+          #define RING_LEN (20U)
+          FixedLengthRing<int,  RING_LEN > ring;
+
+          int main( void ) {
+             // Ring is empty
+
+             ring.queue( 111 );
+             ring.queue( 222 );
+
+             FixedLengthRing<int, RING_LEN>::iterator it = ring.begin();
+             *it == 111;
+             it++;
+             *it == 222;
+             it++;
+             *it == ring.end();
+          }
+   \endcode
+*/
+template< class T, size_t queueMax > class FixedLengthRingIter
+{
+    protected:
+        /** The ring being iterated */
+        FixedLengthRing< T, queueMax >* m_ring;
+        /** Position of the item relative to the start of the ring */
+        size_t m_pos;
+    public:
+        /** Void constructor - iterator will be equal to T::end() */
+        FixedLengthRingIter( void );
+        /** Construct an iterator which points to a position within a
+            FixedLengthRing */
+        FixedLengthRingIter( FixedLengthRing< T, queueMax >* p_ring, size_t p_pos );
+        /** De-reference operator, yields the value of the item */
+        T& operator*();
+        /** Inequality operator */
+        bool operator!=( const FixedLengthRingIter& p_comp ) const;
+        /** Equality operator */
+        bool operator==( const FixedLengthRingIter& p_comp ) const;
+        /** Move the iterator forward a specified number of elements
+
+            \param p_inc Number of items to traverse */
+        FixedLengthRingIter& operator+=( const unsigned p_inc );
+        /** Post-increment operator */
+        FixedLengthRingIter operator++( int p_int );
+        /** Pre-increment operator */
+        FixedLengthRingIter& operator++( void );
+};
+
+/**
+   Template class to implement a double-ended queue with a fixed maximum
+   number of elements, offering the same interface as FixedLengthList.
+
+   Where FixedLengthList links its items, FixedLengthRing stores them in a
+   contiguous circular array, tracking the position of the first item and the
+   number of items in use.  Adding or removing an item at either end is
+   therefore a constant time operation with no links to follow, and iteration
+   is a linear scan of memory.  The trade-off is that removing an item from
+   the middle of the ring (see remove()) requires the items on one side of it
+   to be moved.
+
+   In the case that queueMax is a power of two, positions are wrapped by
+   masking, otherwise by a single conditional subtraction.
+
+   Note that the class currently is not thread safe.
+
+   Example:
+   \code
+          #define RING_LEN (16U)
+          FixedLengthRing<int,  RING_LEN > ring;
+
+          int main( void ) {
+             int i;
+
+             ring.queue( 111 );
+             ring.queue( 222 );
+             // Ring now contains 111, 222
+
+             ring.push( 333 );
+             // Ring now contains 333, 111, 222
+
+             ring.dequeue( &i );
+             // i == 222
+             // Ring now contains 333, 111
+
+             return 0;
+          }
+    \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthRing
+{
+    /* Pointless to have a queue with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    STATIC_ASSERT( queueMax > 0, Queue_must_have_a_non_zero_length );
+
+    friend class FixedLengthRingIter< T, queueMax >;
+
+    private:
+        /** Storage for the items */
+        T                       m_items[ queueMax ];
+
+        /** Position within m_items of the first item in the ring */
+        size_t                  m_head;
+
+        /** Keep count of the number of used items in the ring.  Ranges between
+            0 and queueMax */
+        size_t                  m_usedCount;
+
+        /** Wrap a position which may have run past the end of m_items back to
+            the start.
+
+            \param p_pos Position to be wrapped.  Must be less than
+                         2 * queueMax
+            \returns Position within m_items */
+        static size_t wrap( const size_t p_pos );
+
+        /** Map a position relative to the first item in the ring onto a
+            position within m_items */
+        size_t slot( const size_t p_pos ) const;
+
+    public:
+        /** Constructor for FixedLengthRing */
+        FixedLengthRing( void );
+
+        /** Initialising constructor for FixedLengthRing.  Parameters will be
+            used to initialise the ring
+
+            \param p_items An array of items used to initialise the ring.  They
+                           will be added in the order in which they appear in
+                           p_items
+            \param p_count The number of items in p_items.  Only up to queueMax
+                           items will be used - any additional items will be
+                           ignored */
+        FixedLengthRing( const T* const p_items, size_t p_count );
+
+        /**
+           push an item onto the front of the ring
+
+           \param p_item The item to be added to the ring
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool push( const T p_item );
+
+        /**
+           pop an item from the front of the ring (item is removed and returned
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (ring empty)
+        */
+        bool pop( T* const p_item );
+
+        /**
+           queue an item onto the end of the ring
+
+           \param p_item The item to be added to the ring
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool queue( const T p_item );
+
+        /**
+           dequeue an item from the end of the ring (item is removed and
+           returned
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (ring empty)
+        */
+        bool dequeue( T* const p_item );
+
+        /**
+           remove the first item in the ring which matches the specified item.
+           The items between the removed item and the nearer end of the ring
+           are moved to close the gap.
+
+           \param p_item Item to be matched against
+           \returns true in the case that an item was removed
+                    false in the case that no matching item was found
+        */
+        bool remove( const T p_item );
+
+        /** Used to find out how many items are in the ring
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the ring
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        /** Determine whether or not a particular item is in the ring
+
+            \param p_val Item to be matched against
+            \returns true in the case that the item is found in the ring
+                     false in the case that it is not found in the ring
+        */
+        bool inList( const T p_val ) const;
+
+        /** Remove the entire contents of the ring and return it back to
+            an empty state */
+        void clear( void );
+
+        typedef FixedLengthRingIter<T, queueMax> iterator;
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+
+        iterator begin( void );
+        iterator end( void );
+};
+
+
+template < class T, size_t queueMax >
+FixedLengthRing< T, queueMax >::FixedLengthRing( void )
+{
+    clear();
+}
+
+template < class T, size_t queueMax >
+FixedLengthRing< T, queueMax >::FixedLengthRing( const T* const p_items, size_t p_count )
+{
+    /* Can only populate up to queueMax items */
+    size_t init_count = std::min( queueMax, p_count );
+
+    for( size_t i = 0;
+         i < init_count;
+         i++ )
+    {
+        m_items[ i ] = p_items[ i ];
+    }
+
+    m_head = 0U;
+    m_usedCount = init_count;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthRing< T, queueMax >::wrap( const size_t p_pos )
+{
+    size_t ret_val;
+
+    /* Constant condition, so only one of these branches will survive
+       compilation */
+    if( ( queueMax & ( queueMax - 1U ) ) == 0U )
+    {
+        ret_val = p_pos & ( queueMax - 1U );
+    }
+    else
+    {
+        ret_val = ( p_pos >= queueMax ) ? ( p_pos - queueMax ) : p_pos;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthRing< T, queueMax >::slot( const size_t p_pos ) const
+{
+    return wrap( m_head + p_pos );
+}
+
+template < class T, size_t queueMax >
+void FixedLengthRing< T, queueMax >::clear( void )
+{
+    m_head = 0U;
+    m_usedCount = 0U;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRing< T, queueMax >::push( const T p_item )
+{
+    bool ret_val = false;
+
+    /* Check that there's space in the ring */
+    if( m_usedCount < queueMax )
+    {
+        /* Step the head back by one, wrapping to the end of m_items */
+        m_head = wrap( m_head + queueMax - 1U );
+
+        m_items[ m_head ] = p_item;
+
+        m_usedCount++;
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRing< T, queueMax >::queue( const T p_item )
+{
+    bool ret_val = false;
+
+    /* Check that there's space in the ring */
+    if( m_usedCount < queueMax )
+    {
+        m_items[ slot( m_usedCount ) ] = p_item;
+
+        m_usedCount++;
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRing< T, queueMax >::pop( T* const p_item )
+{
+    bool ret_val = false;
+
+    if( m_usedCount > 0U )
+    {
+        *p_item = m_items[ m_head ];
+
+        m_head = wrap( m_head + 1U );
+
+        m_usedCount--;
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRing< T, queueMax >::dequeue( T* const p_item )
+{
+    bool ret_val = false;
+
+    if( m_usedCount > 0U )
+    {
+        m_usedCount--;
+
+        *p_item = m_items[ slot( m_usedCount ) ];
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRing< T, queueMax >::remove( const T p_item )
+{
+    bool ret_val = false;
+
+    for( size_t pos = 0;
+         pos < m_usedCount;
+         pos++ )
+    {
+        /* Does the item match the one we're looking for? */
+        if( m_items[ slot( pos ) ] == p_item )
+        {
+            /* Close the gap by moving whichever side of the item has fewer
+               items in it */
+            if( pos < ( m_usedCount / 2U ) )
+            {
+                for( size_t i = pos;
+                     i > 0;
+                     i-- )
+                {
+                    m_items[ slot( i ) ] = m_items[ slot( i - 1U ) ];
+                }
+                m_head = wrap( m_head + 1U );
+            }
+            else
+            {
+                for( size_t i = pos + 1U;
+                     i < m_usedCount;
+                     i++ )
+                {
+                    m_items[ slot( i - 1U ) ] = m_items[ slot( i ) ];
+                }
+            }
+
+            m_usedCount--;
+
+            ret_val = true;
+            break;
+        }
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthRing< T, queueMax >::used() const
+{
+    return m_usedCount;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthRing< T, queueMax >::available() const
+{
+    return queueMax - m_usedCount;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRing< T, queueMax >::inList( const T p_val ) const
+{
+    bool ret_val = false;
+
+    /* The used items occupy at most two contiguous runs within m_items: from
+       the head to the end of the array and then from the start of the
+       array */
+    size_t first_run = std::min( m_usedCount, queueMax - m_head );
+    const T* p = &( m_items[ m_head ] );
+    const T* const first_end = p + first_run;
+    const T* const second_end = &( m_items[ m_usedCount - first_run ] );
+
+    while( p != first_end )
+    {
+        if( *p == p_val ) {
+            ret_val = true;
+            break;
+        }
+        p++;
+    }
+
+    if( !ret_val )
+    {
+        for( p = m_items;
+             p != second_end;
+             p++ )
+        {
+            if( *p == p_val ) {
+                ret_val = true;
+                break;
+            }
+        }
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter<T, queueMax> FixedLengthRing< T, queueMax >::begin( void )
+{
+    return iterator( this, 0U );
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter<T, queueMax> FixedLengthRing< T, queueMax >::end( void )
+{
+    return iterator( this, m_usedCount );
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter< T, queueMax >::FixedLengthRingIter( void ) : m_ring( NULL ), m_pos( 0U )
+{
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter< T, queueMax >::FixedLengthRingIter( FixedLengthRing< T, queueMax >* p_ring, size_t p_pos ) : m_ring( p_ring ), m_pos( p_pos )
+{
+}
+
+template < class T, size_t queueMax >
+T& FixedLengthRingIter< T, queueMax >::operator*()
+{
+    return m_ring->m_items[ m_ring->slot( m_pos ) ];
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter< T, queueMax > FixedLengthRingIter< T, queueMax >::operator++( int p_int )
+{
+    FixedLengthRingIter< T, queueMax > clone( *this );
+    m_pos++;
+    return clone;
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter< T, queueMax >& FixedLengthRingIter< T, queueMax >::operator++( void )
+{
+    m_pos++;
+    return *this;
+}
+
+template < class T, size_t queueMax >
+FixedLengthRingIter< T, queueMax >& FixedLengthRingIter< T, queueMax >::operator+=( const unsigned p_inc ) {
+    /* Don't allow the iterator to run past end() */
+    m_pos = std::min( m_pos + p_inc, m_ring->m_usedCount );
+    return *this;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRingIter< T, queueMax >::operator==( const FixedLengthRingIter& p_comp ) const
+{
+    return m_pos == p_comp.m_pos;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthRingIter< T, queueMax >::operator!=( const FixedLengthRingIter& p_comp ) const
+{
+    return m_pos != p_comp.m_pos;
+}
+
+
+#endif
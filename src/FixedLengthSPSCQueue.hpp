@@ -0,0 +1,296 @@
+/**
+   @file
+   @brief Template class ( FixedLengthSPSCQueue ) to implement a lock-free
+          queue with a limited number of elements, for passing items from a
+          single producer to a single consumer.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHSPSCQUEUE_HPP
+#define      FIXEDLENGTHSPSCQUEUE_HPP
+
+#include <cstddef> // for size_t
+#include <algorithm> // for min()
+#include <atomic>
+
+#ifndef FIXEDLENGTH_CACHE_LINE_SIZE
+/** Size of a cache line, used to keep data written by different threads
+    apart.  May be overridden to suit the target */
+#define FIXEDLENGTH_CACHE_LINE_SIZE (64U)
+#endif
+
+/**
+   Template class to implement a first-in, first-out queue with a fixed
+   maximum number of elements which may be safely shared between one producer
+   thread (or interrupt handler) and one consumer thread without locking.
+
+   Items are held in a contiguous circular array, as FixedLengthRing.  The
+   producer owns the tail position and the consumer owns the head position,
+   each publishing updates to the other with a release store which is read
+   with an acquire load.  Each side also keeps a cached copy of the other's
+   position and only re-reads the shared value when the cached one indicates
+   that the queue is full (producer) or empty (consumer), so in the common
+   case neither side touches the cache line written by the other.  No locked
+   (read-modify-write) instructions are used.
+
+   Positions run from 0 to ( 2 * queueMax ) - 1 so that a full queue can be
+   told apart from an empty one without sacrificing a slot.  As with
+   FixedLengthRing, wrapping is done by masking in the case that queueMax is a
+   power of two.
+
+   The class requires C++11.  For use from an interrupt handler,
+   std::atomic<size_t> must be lock-free on the target.
+
+   Only queue() may be called by the producer and only pop() by the
+   consumer.  used() and available() may be called from either side, but
+   the result is only a snapshot as the other side may be running
+   concurrently.
+
+   Example:
+   \code
+          #define QUEUE_LEN (64U)
+          FixedLengthSPSCQueue<int,  QUEUE_LEN > q;
+
+          // Producer thread
+          void produce( int i ) {
+             while( !q.queue( i ) ) {
+                // Queue full - wait for the consumer
+             }
+          }
+
+          // Consumer thread
+          void consume( void ) {
+             int i;
+             if( q.pop( &i ) ) {
+                // Process i
+             }
+          }
+    \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthSPSCQueue
+{
+    /* Pointless to have a queue with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    static_assert( queueMax > 0, "Queue must have a non-zero length" );
+
+    private:
+        /** Position of the next slot to be written.  Written by the producer
+            only */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<size_t> m_tail;
+
+        /** Producer's copy of m_head, as of the last time it was read */
+        size_t                  m_headCache;
+
+        /** Position of the next slot to be read.  Written by the consumer
+            only */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<size_t> m_head;
+
+        /** Consumer's copy of m_tail, as of the last time it was read */
+        size_t                  m_tailCache;
+
+        /** Storage for the items */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) T m_items[ queueMax ];
+
+        /** Advance a position by one, wrapping at 2 * queueMax */
+        static size_t advance( const size_t p_pos );
+
+        /** Number of items between two positions */
+        static size_t distance( const size_t p_head, const size_t p_tail );
+
+        /** Map a position onto a slot within m_items */
+        static size_t slot( const size_t p_pos );
+
+    public:
+        /** Constructor for FixedLengthSPSCQueue */
+        FixedLengthSPSCQueue( void );
+
+        FixedLengthSPSCQueue( const FixedLengthSPSCQueue& ) = delete;
+        FixedLengthSPSCQueue& operator=( const FixedLengthSPSCQueue& ) = delete;
+
+        /**
+           queue an item onto the end of the queue.  Must only be called by the
+           producer
+
+           \param p_item The item to be added to the queue
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool queue( const T& p_item );
+
+        /**
+           pop an item from the front of the queue (item is removed and
+           returned).  Must only be called by the consumer
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (queue
+                    empty)
+        */
+        bool pop( T* const p_item );
+
+        /** Used to find out how many items are in the queue
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the queue
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax >
+FixedLengthSPSCQueue< T, queueMax >::FixedLengthSPSCQueue( void ) : m_tail( 0U ), m_headCache( 0U ), m_head( 0U ), m_tailCache( 0U )
+{
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSPSCQueue< T, queueMax >::advance( const size_t p_pos )
+{
+    size_t ret_val;
+
+    if( ( queueMax & ( queueMax - 1U ) ) == 0U )
+    {
+        ret_val = ( p_pos + 1U ) & ( ( 2U * queueMax ) - 1U );
+    }
+    else
+    {
+        ret_val = ( p_pos == ( ( 2U * queueMax ) - 1U ) ) ? 0U : ( p_pos + 1U );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSPSCQueue< T, queueMax >::distance( const size_t p_head, const size_t p_tail )
+{
+    size_t ret_val;
+
+    if( ( queueMax & ( queueMax - 1U ) ) == 0U )
+    {
+        ret_val = ( p_tail - p_head ) & ( ( 2U * queueMax ) - 1U );
+    }
+    else
+    {
+        ret_val = ( p_tail >= p_head ) ? ( p_tail - p_head ) : ( p_tail + ( 2U * queueMax ) - p_head );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSPSCQueue< T, queueMax >::slot( const size_t p_pos )
+{
+    size_t ret_val;
+
+    if( ( queueMax & ( queueMax - 1U ) ) == 0U )
+    {
+        ret_val = p_pos & ( queueMax - 1U );
+    }
+    else
+    {
+        ret_val = ( p_pos >= queueMax ) ? ( p_pos - queueMax ) : p_pos;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSPSCQueue< T, queueMax >::queue( const T& p_item )
+{
+    bool ret_val = false;
+
+    /* Only the producer writes m_tail, so no ordering is needed to read it */
+    const size_t tail = m_tail.load( std::memory_order_relaxed );
+
+    /* Queue appears full?  Refresh the copy of the consumer's position
+       before giving up */
+    if( distance( m_headCache, tail ) == queueMax )
+    {
+        m_headCache = m_head.load( std::memory_order_acquire );
+    }
+
+    /* Check that there's space in the queue */
+    if( distance( m_headCache, tail ) != queueMax )
+    {
+        m_items[ slot( tail ) ] = p_item;
+
+        /* Publish the item to the consumer */
+        m_tail.store( advance( tail ), std::memory_order_release );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSPSCQueue< T, queueMax >::pop( T* const p_item )
+{
+    bool ret_val = false;
+
+    /* Only the consumer writes m_head, so no ordering is needed to read it */
+    const size_t head = m_head.load( std::memory_order_relaxed );
+
+    /* Queue appears empty?  Refresh the copy of the producer's position
+       before giving up */
+    if( head == m_tailCache )
+    {
+        m_tailCache = m_tail.load( std::memory_order_acquire );
+    }
+
+    if( head != m_tailCache )
+    {
+        *p_item = m_items[ slot( head ) ];
+
+        /* Hand the slot back to the producer */
+        m_head.store( advance( head ), std::memory_order_release );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSPSCQueue< T, queueMax >::used() const
+{
+    /* Read the head first - it can only move towards the tail, so when
+       called by the producer or the consumer the result can't exceed
+       queueMax.  Any other caller could see the consumer lap the producer
+       between the two reads, so clamp the result */
+    const size_t head = m_head.load( std::memory_order_acquire );
+    return std::min( distance( head, m_tail.load( std::memory_order_acquire ) ), queueMax );
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSPSCQueue< T, queueMax >::available() const
+{
+    return queueMax - used();
+}
+
+#endif
@@ -0,0 +1,387 @@
+/**
+   @file
+   @brief Template class ( FixedLengthSharedList ) to implement a list with
+          a limited number of elements which may be placed in memory shared
+          between processes.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHSHAREDLIST_HPP
+#define      FIXEDLENGTHSHAREDLIST_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <stdint.h> // for uint32_t
+#include <atomic>
+#include <new> // for placement new
+#include <thread> // for yield()
+#include <type_traits>
+
+#include "FixedLengthList.hpp"
+
+/**
+   Template class to implement a list with a fixed maximum number of
+   elements which may be placed in a region of memory shared between
+   processes - e.g. POSIX shared memory or a memory-mapped file - and used by
+   all of them at once, so that records can be exchanged without copying
+   them through a socket or pipe.
+
+   The list is a FixedLengthList using FixedLengthListCompactDoubleLinks, so
+   items are linked by their index in the pool rather than by address.  The
+   region may therefore be mapped at a different address in each process
+   (or the contents of a mapped file saved and mapped again later).  The
+   class is standard layout and holds no pointers, so for trivially copyable
+   T (which is required) it may also be moved with memcpy().
+
+   Each operation is made under a spin lock held within the region.  The
+   lock is a std::atomic_flag, which is always lock-free and therefore works
+   between processes.  Note that should a process die while holding the
+   lock (i.e. part way through an operation) the other processes will spin
+   forever, so the list is best suited to co-operating processes which are
+   restarted together.
+
+   The list isn't constructed directly - one process calls create() to
+   construct it in the region, after which other processes call attach() to
+   make use of it.  attach() checks that the region holds a list of the
+   same type (as far as the size and number of items), returning NULL
+   until create() has completed.  No destructor need be called - the region
+   may simply be unmapped.
+
+   The class requires C++11.
+
+   Example:
+   \code
+          typedef FixedLengthSharedList< Record, 256 > shared_t;
+
+          // Creating process
+          int fd = shm_open( "/records", O_CREAT | O_RDWR, 0600 );
+          ftruncate( fd, sizeof( shared_t ) );
+          void* mem = mmap( NULL, sizeof( shared_t ), PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd, 0 );
+          shared_t* list = shared_t::create( mem, sizeof( shared_t ) );
+          list->queue( r );
+
+          // Any other process
+          int fd = shm_open( "/records", O_RDWR, 0600 );
+          void* mem = mmap( NULL, sizeof( shared_t ), PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd, 0 );
+          shared_t* list = shared_t::attach( mem, sizeof( shared_t ) );
+          if( list && list->pop( &r ) ) {
+             // Process r
+          }
+    \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthSharedList
+{
+    static_assert( std::is_trivially_copyable<T>::value, "T must be trivially copyable to be shared between processes" );
+    static_assert( ATOMIC_INT_LOCK_FREE == 2, "Atomics must be lock-free to be shared between processes" );
+
+    private:
+        /** The list in use */
+        typedef FixedLengthList< T, queueMax, FixedLengthListCompactDoubleLinks > list_t;
+
+        /** Value of m_magic once the list has been constructed */
+        static const uint32_t MAGIC = 0x464C534CU;
+
+        /** MAGIC once create() has constructed the list, allowing it to be
+            attached to */
+        std::atomic<uint32_t> m_magic;
+
+        /** sizeof( FixedLengthSharedList ), checked by attach() */
+        uint32_t              m_size;
+
+        /** sizeof( T ), checked by attach() */
+        uint32_t              m_itemSize;
+
+        /** queueMax, checked by attach() */
+        uint32_t              m_queueMax;
+
+        /** Held while an operation is being made on the list */
+        mutable std::atomic_flag m_lock;
+
+        /** The list itself */
+        list_t                m_list;
+
+        /** Constructor for FixedLengthSharedList.  Use create() */
+        FixedLengthSharedList( void );
+
+        /** Check that p_mem is large enough and suitably aligned to hold the
+            list */
+        static bool fits( const void* const p_mem, const size_t p_size );
+
+        /** Take the lock, spinning until it is available */
+        void lock( void ) const;
+
+        /** Release the lock */
+        void unlock( void ) const;
+
+    public:
+        FixedLengthSharedList( const FixedLengthSharedList& ) = delete;
+        FixedLengthSharedList& operator=( const FixedLengthSharedList& ) = delete;
+
+        /**
+           Construct an empty list in a shared region.  Must be called by one
+           process only, before any other attaches to the region
+
+           \param p_mem Start of the region.  Must be aligned as
+                        FixedLengthSharedList
+           \param p_size Size of the region, in bytes
+           \returns The list, or NULL in the case that the region is too small
+                    or misaligned */
+        static FixedLengthSharedList* create( void* const p_mem, const size_t p_size );
+
+        /**
+           Make use of a list which has been constructed in a shared region by
+           create()
+
+           \param p_mem Start of the region, which may be mapped at a different
+                        address than that passed to create()
+           \param p_size Size of the region, in bytes
+           \returns The list, or NULL in the case that the region does not
+                    (yet) hold a list of this type */
+        static FixedLengthSharedList* attach( void* const p_mem, const size_t p_size );
+
+        /**
+           push an item onto the front of the list
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool push( const T& p_item );
+
+        /**
+           pop an item from the front of the list (item is removed and returned
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (list empty)
+        */
+        bool pop( T* const p_item );
+
+        /**
+           queue an item onto the end of the list
+
+           \param p_item The item to be added to the list
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool queue( const T& p_item );
+
+        /**
+           dequeue an item from the end of the list (item is removed and
+           returned
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (list empty)
+        */
+        bool dequeue( T* const p_item );
+
+        /**
+           remove the first occurrence of the specified item from the list
+
+           \param p_item The item to be removed
+           \returns true in the case that the item was found and removed
+                    false in the case that the item was not found */
+        bool remove( const T& p_item );
+
+        /** Determine whether or not a particular item is in the list
+
+            \param p_val Item to be matched against
+            \returns true in the case that the item is found in the list
+                     false in the case that it is not found in the list */
+        bool inList( const T& p_val ) const;
+
+        /** Used to find out how many items are in the list.  Only a snapshot,
+            as other processes may be using the list
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the list.
+            Only a snapshot, as other processes may be using the list
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        /** Remove all items from the list */
+        void clear( void );
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax >
+FixedLengthSharedList< T, queueMax >::FixedLengthSharedList( void ) : m_magic( 0U ), m_size( sizeof( FixedLengthSharedList ) ),
+                                                                      m_itemSize( sizeof( T ) ), m_queueMax( queueMax ), m_list()
+{
+    m_lock.clear( std::memory_order_relaxed );
+
+    /* Publish the list to attach() */
+    m_magic.store( MAGIC, std::memory_order_release );
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::fits( const void* const p_mem, const size_t p_size )
+{
+    return ( p_mem != NULL ) &&
+           ( p_size >= sizeof( FixedLengthSharedList ) ) &&
+           ( ( reinterpret_cast< uintptr_t >( p_mem ) % alignof( FixedLengthSharedList ) ) == 0U );
+}
+
+template < class T, size_t queueMax >
+FixedLengthSharedList< T, queueMax >* FixedLengthSharedList< T, queueMax >::create( void* const p_mem, const size_t p_size )
+{
+    static_assert( std::is_standard_layout< FixedLengthSharedList >::value, "Shared list must be standard layout" );
+
+    FixedLengthSharedList* ret_val = NULL;
+
+    if( fits( p_mem, p_size ) )
+    {
+        ret_val = ::new( p_mem ) FixedLengthSharedList();
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+FixedLengthSharedList< T, queueMax >* FixedLengthSharedList< T, queueMax >::attach( void* const p_mem, const size_t p_size )
+{
+    FixedLengthSharedList* ret_val = NULL;
+
+    if( fits( p_mem, p_size ) )
+    {
+        FixedLengthSharedList* list = static_cast< FixedLengthSharedList* >( p_mem );
+
+        /* Pairs with the release in the constructor, so that the rest of the
+           list is visible once the magic number is */
+        if( ( list->m_magic.load( std::memory_order_acquire ) == MAGIC ) &&
+            ( list->m_size == sizeof( FixedLengthSharedList ) ) &&
+            ( list->m_itemSize == sizeof( T ) ) &&
+            ( list->m_queueMax == queueMax ) )
+        {
+            ret_val = list;
+        }
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+void FixedLengthSharedList< T, queueMax >::lock( void ) const
+{
+    while( m_lock.test_and_set( std::memory_order_acquire ) )
+    {
+        std::this_thread::yield();
+    }
+}
+
+template < class T, size_t queueMax >
+void FixedLengthSharedList< T, queueMax >::unlock( void ) const
+{
+    m_lock.clear( std::memory_order_release );
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::push( const T& p_item )
+{
+    lock();
+    bool ret_val = m_list.push( p_item );
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::pop( T* const p_item )
+{
+    lock();
+    bool ret_val = m_list.pop( p_item );
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::queue( const T& p_item )
+{
+    lock();
+    bool ret_val = m_list.queue( p_item );
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::dequeue( T* const p_item )
+{
+    lock();
+    bool ret_val = m_list.dequeue( p_item );
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::remove( const T& p_item )
+{
+    lock();
+    bool ret_val = m_list.remove( p_item );
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthSharedList< T, queueMax >::inList( const T& p_val ) const
+{
+    lock();
+    bool ret_val = m_list.inList( p_val );
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSharedList< T, queueMax >::used() const
+{
+    lock();
+    size_t ret_val = m_list.used();
+    unlock();
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthSharedList< T, queueMax >::available() const
+{
+    return queueMax - used();
+}
+
+template < class T, size_t queueMax >
+void FixedLengthSharedList< T, queueMax >::clear( void )
+{
+    lock();
+    m_list.clear();
+    unlock();
+}
+
+#endif
@@ -0,0 +1,615 @@
+/**
+   @file
+   @brief Template class ( FixedLengthTimerWheel ) to implement a
+          hierarchical timer wheel, holding a limited number of timers in a
+          fixed size pool.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHTIMERWHEEL_HPP
+#define      FIXEDLENGTHTIMERWHEEL_HPP
+
+#include <cstddef> // for size_t, NULL
+#include <stdint.h> // for uint32_t
+#include <new> // for placement new
+
+#include "FixedLengthPool.hpp"
+
+/** A timer within a FixedLengthTimerWheel */
+template < class T > class FixedLengthTimerWheelEntry
+{
+    public:
+        FixedLengthTimerWheelEntry( const T& p_value, const uint32_t p_expiry ) : m_value( p_value ), m_expiry( p_expiry ), m_bucket( 0U ) {}
+
+        /** The item to be returned on expiry */
+        T m_value;
+
+        /** Tick on which the timer expires */
+        uint32_t m_expiry;
+
+        /** Bucket whose list the timer is in */
+        size_t m_bucket;
+};
+
+/**
+   Refers to a timer scheduled with a FixedLengthTimerWheel, so that it may
+   be cancelled.  A handle remains safe to use once its timer has expired
+   or been cancelled (and its slot re-used by another timer), in that it
+   then no longer refers to any timer.
+*/
+class FixedLengthTimerWheelHandle
+{
+    template < class, size_t, size_t, size_t > friend class FixedLengthTimerWheel;
+
+    public:
+        /** Constructor - the handle refers to no timer */
+        FixedLengthTimerWheelHandle( void ) : m_slot( 0U ), m_generation( 0U ) {}
+
+    private:
+        /** Position of the timer within the wheel's pool */
+        size_t m_slot;
+
+        /** Generation of the slot when the timer was scheduled.  Always odd
+            for a handle referring to a timer */
+        uint32_t m_generation;
+};
+
+/**
+   Template class to implement a hierarchical timer wheel holding up to
+   timerMax timers, each of which carries an item of type T which is handed
+   back once the timer expires.
+
+   Time is measured in ticks, advanced by calling tick() (or advance()).
+   Level 0 of the wheel has wheelSlots buckets, one per tick, and each
+   subsequent level has wheelSlots buckets each spanning a whole revolution
+   of the level below.  A timer is placed in the lowest level whose range
+   covers its delay, and is moved down a level (cascaded) as the level
+   below wraps around.  Timers beyond the range of the top level are
+   placed in its furthest bucket and re-placed each time it is reached.
+   wheelSlots must be a power of two, and wheelSlots ^ ( wheelLevels - 1 )
+   must fit in a uint32_t.
+
+   The timers are held in a FixedLengthPool (using
+   FixedLengthListCompactDoubleLinks) shared by all of the buckets, each
+   bucket being a list of timers threaded through the pool's links in the
+   same way as FixedLengthList.  schedule() and cancel() are therefore
+   constant time, and each tick touches only the bucket which expires (and,
+   once per revolution of a level, the bucket cascaded from the level
+   above).  No dynamic memory is used.
+
+   Expired timers are moved to a queue, from which their items are taken
+   with expired().  Timers expiring on the same tick are queued in no
+   particular order.
+
+   Note that the class currently is not thread safe.
+
+   Example:
+   \code
+          // Up to 64 outstanding requests, with a 1ms tick
+          FixedLengthTimerWheel< RequestId, 64 > timeouts;
+
+          void send( const RequestId p_id, FixedLengthTimerWheelHandle* const p_timer ) {
+             timeouts.schedule( p_id, 250U, p_timer );
+          }
+
+          void on_response( const FixedLengthTimerWheelHandle& p_timer ) {
+             timeouts.cancel( p_timer );
+          }
+
+          void on_1ms( void ) {
+             RequestId id;
+             timeouts.tick();
+             while( timeouts.expired( &id ) ) {
+                retry( id );
+             }
+          }
+   \endcode
+*/
+template < class T, size_t timerMax, size_t wheelSlots = 64U, size_t wheelLevels = 4U > class FixedLengthTimerWheel
+{
+    /* Pointless to have a wheel with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    STATIC_ASSERT( timerMax > 0, Wheel_must_have_a_non_zero_length );
+    STATIC_ASSERT( ( wheelSlots > 1 ) && ( ( wheelSlots & ( wheelSlots - 1U ) ) == 0 ), Wheel_slots_must_be_a_power_of_two );
+    STATIC_ASSERT( wheelLevels > 0, Wheel_must_have_at_least_one_level );
+
+    public:
+        /** Type used to count ticks.  Times wrap around, so delays must be
+            less than 2^31 ticks */
+        typedef uint32_t tick_t;
+
+        /** Type referring to a scheduled timer */
+        typedef FixedLengthTimerWheelHandle handle_t;
+
+    private:
+        /** Type of the timers held in the pool */
+        typedef FixedLengthTimerWheelEntry< T > entry_t;
+
+        /** Pool of timers.  Backward links are needed to unlink a timer in
+            constant time */
+        typedef FixedLengthPool< entry_t, timerMax, FixedLengthListCompactDoubleLinks > pool_t;
+
+        /** The link policy in use */
+        typedef typename pool_t::links_t links_t;
+
+        /** Type used by the link policy to refer to a timer */
+        typedef typename pool_t::link_t link_t;
+
+        /** Bucket holding the queue of expired timers, after those of the
+            wheel's levels */
+        enum { EXPIRED = wheelLevels * wheelSlots };
+
+        /** Pool of timers, along with the links between them */
+        pool_t                  m_pool;
+
+        /** Link to the first timer in each bucket, level by level, followed
+            by the queue of expired timers.  nil in the case that the bucket
+            is empty */
+        link_t                  m_buckets[ EXPIRED + 1 ];
+
+        /** Link to the last timer in the queue of expired timers */
+        link_t                  m_expiredTail;
+
+        /** Generation of each slot in the pool, incremented as a timer is
+            put into or taken out of the slot.  Odd while the slot is in
+            use */
+        uint32_t                m_generation[ timerMax ];
+
+        /** The current tick */
+        tick_t                  m_now;
+
+        /** Place a timer in the bucket for its expiry */
+        void insert( const link_t p_item );
+
+        /** Add a timer to the end of the queue of expired timers */
+        void insert_expired( const link_t p_item );
+
+        /** Unlink a timer from whichever bucket it is in */
+        void unlink( const link_t p_item );
+
+        /** Destroy a timer and return it to the pool */
+        void release( const link_t p_item );
+
+        /** Re-place all of the timers in a bucket according to the time
+            remaining, moving them to lower levels */
+        void cascade( const size_t p_bucket );
+
+        /** Find the timer referred to by a handle
+
+            \returns The timer, or nil in the case that the handle does not
+                     refer to a timer */
+        link_t find( const handle_t& p_handle ) const;
+
+        /* Not copyable - handles refer to the pool's slots */
+        FixedLengthTimerWheel( const FixedLengthTimerWheel& );
+        FixedLengthTimerWheel& operator=( const FixedLengthTimerWheel& );
+
+    public:
+        /** Constructor for FixedLengthTimerWheel.  Linear in timerMax */
+        FixedLengthTimerWheel( void );
+
+        /** Destructor for FixedLengthTimerWheel.  Destroys any timers */
+        ~FixedLengthTimerWheel( void );
+
+        /**
+           schedule a timer.  Constant time
+
+           \param p_item Item to be returned by expired() once the timer
+                         expires
+           \param p_delay Number of ticks before the timer expires.  In the
+                          case that this is zero the timer expires
+                          immediately
+           \param p_handle Pointer to be populated with a handle to the
+                           timer, for use with cancel().  May be NULL
+           \returns true in the case that the timer was scheduled
+                    false in the case that the wheel was full
+        */
+        bool schedule( const T& p_item, const tick_t p_delay, handle_t* const p_handle = NULL );
+
+        /**
+           cancel a timer, whether or not it has expired, so long as its item
+           has not yet been taken with expired().  Constant time
+
+           \param p_handle Handle to the timer
+           \param p_item Pointer to be populated with the timer's item, may be
+                         NULL
+           \returns true in the case that the timer was cancelled
+                    false in the case that the handle no longer refers to a
+                          timer
+        */
+        bool cancel( const handle_t& p_handle, T* const p_item = NULL );
+
+        /** Determine whether or not a timer has yet to expire
+
+            \returns true in the case that the handle refers to a timer which
+                          has not expired
+                     false otherwise */
+        bool pending( const handle_t& p_handle ) const;
+
+        /**
+           advance time by one tick, moving any timers which expire on that
+           tick to the queue of expired timers
+
+           \returns Number of timers which expired
+        */
+        size_t tick( void );
+
+        /**
+           advance time by a number of ticks, as calling tick() p_ticks times
+
+           \returns Number of timers which expired
+        */
+        size_t advance( const tick_t p_ticks );
+
+        /**
+           take the item from the earliest expired timer (of those which have
+           expired, but not yet been taken)
+
+           \param p_item Pointer to be populated with the item, may be NULL
+           \returns true in the case that an item was taken
+                    false in the case that there are no expired timers
+        */
+        bool expired( T* const p_item );
+
+        /** Retrieve the current tick, which starts at zero */
+        tick_t now( void ) const;
+
+        /** Used to find out how many timers are in the wheel, including those
+            which have expired but have not been taken
+
+            \returns Number of timers, ranging from 0 to timerMax */
+        size_t used() const;
+
+        /** Used to find out how many more timers may be scheduled
+
+            \returns Number of available timers, ranging from 0 to timerMax */
+        size_t available() const;
+
+        /** Cancel (and destroy) all timers, including those which have
+            expired but have not been taken.  The current tick is not
+            affected */
+        void clear( void );
+};
+
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::FixedLengthTimerWheel( void ) : m_expiredTail( links_t::nil() ),
+                                                                                             m_now( 0U )
+{
+    for( size_t i = 0;
+         i <= EXPIRED;
+         i++ )
+    {
+        m_buckets[ i ] = links_t::nil();
+    }
+
+    for( size_t i = 0;
+         i < timerMax;
+         i++ )
+    {
+        m_generation[ i ] = 0U;
+    }
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::~FixedLengthTimerWheel( void )
+{
+    clear();
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+void FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::insert( const link_t p_item )
+{
+    links_t& items = m_pool.links();
+    entry_t& entry = items.item( p_item );
+    tick_t delta = entry.m_expiry - m_now;
+    tick_t span = 1U;
+    size_t level = 0U;
+
+    /* Find the lowest level whose range covers the delay */
+    while( ( ( level + 1U ) < wheelLevels ) && ( ( delta / span ) >= wheelSlots ) )
+    {
+        span *= wheelSlots;
+        level++;
+    }
+
+    /* Beyond the range of the top level, so park the timer in the bucket
+       furthest away.  It will be re-placed once that bucket is reached */
+    tick_t when = ( ( delta / span ) >= wheelSlots ) ? ( m_now + ( ( wheelSlots - 1U ) * span ) ) : entry.m_expiry;
+    size_t bucket = ( level * wheelSlots ) + ( ( when / span ) & ( wheelSlots - 1U ) );
+
+    entry.m_bucket = bucket;
+    items.set_prev( p_item, links_t::nil() );
+    items.set_next( p_item, m_buckets[ bucket ] );
+
+    if( m_buckets[ bucket ] != links_t::nil() )
+    {
+        items.set_prev( m_buckets[ bucket ], p_item );
+    }
+
+    m_buckets[ bucket ] = p_item;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+void FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::insert_expired( const link_t p_item )
+{
+    links_t& items = m_pool.links();
+
+    items.item( p_item ).m_bucket = EXPIRED;
+    items.set_next( p_item, links_t::nil() );
+    items.set_prev( p_item, m_expiredTail );
+
+    if( m_expiredTail != links_t::nil() )
+    {
+        items.set_next( m_expiredTail, p_item );
+    }
+    else
+    {
+        m_buckets[ EXPIRED ] = p_item;
+    }
+
+    m_expiredTail = p_item;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+void FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::unlink( const link_t p_item )
+{
+    links_t& items = m_pool.links();
+    size_t bucket = items.item( p_item ).m_bucket;
+    link_t prev = items.prev( p_item );
+    link_t next = items.next( p_item );
+
+    if( prev == links_t::nil() )
+    {
+        m_buckets[ bucket ] = next;
+    }
+    else
+    {
+        items.set_next( prev, next );
+    }
+
+    if( next != links_t::nil() )
+    {
+        items.set_prev( next, prev );
+    }
+    else if( bucket == EXPIRED )
+    {
+        m_expiredTail = prev;
+    }
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+void FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::release( const link_t p_item )
+{
+    m_pool.links().item( p_item ).~entry_t();
+    m_generation[ m_pool.links().index( p_item ) ]++;
+    m_pool.release( p_item );
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+void FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::cascade( const size_t p_bucket )
+{
+    link_t p = m_buckets[ p_bucket ];
+
+    m_buckets[ p_bucket ] = links_t::nil();
+
+    while( p != links_t::nil() )
+    {
+        link_t next = m_pool.links().next( p );
+        insert( p );
+        p = next;
+    }
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+typename FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::link_t FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::find( const handle_t& p_handle ) const
+{
+    link_t ret_val = links_t::nil();
+
+    if( ( p_handle.m_slot < timerMax ) &&
+        ( ( p_handle.m_generation & 1U ) != 0U ) &&
+        ( m_generation[ p_handle.m_slot ] == p_handle.m_generation ) )
+    {
+        ret_val = m_pool.links().slot( p_handle.m_slot );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+bool FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::schedule( const T& p_item, const tick_t p_delay, handle_t* const p_handle )
+{
+    bool ret_val = false;
+    link_t p = m_pool.allocate();
+
+    if( p != links_t::nil() )
+    {
+        ::new( static_cast<void*>( &( m_pool.links().item( p ) ) ) ) entry_t( p_item, m_now + p_delay );
+
+        /* The current tick's bucket has already been emptied, so a timer
+           with no delay goes straight to the expired queue */
+        if( p_delay == 0U )
+        {
+            insert_expired( p );
+        }
+        else
+        {
+            insert( p );
+        }
+
+        size_t slot = m_pool.links().index( p );
+        m_generation[ slot ]++;
+
+        if( p_handle != NULL )
+        {
+            p_handle->m_slot = slot;
+            p_handle->m_generation = m_generation[ slot ];
+        }
+
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+bool FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::cancel( const handle_t& p_handle, T* const p_item )
+{
+    bool ret_val = false;
+    link_t p = find( p_handle );
+
+    if( p != links_t::nil() )
+    {
+        if( p_item != NULL )
+        {
+            *p_item = m_pool.links().item( p ).m_value;
+        }
+
+        unlink( p );
+        release( p );
+
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+bool FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::pending( const handle_t& p_handle ) const
+{
+    link_t p = find( p_handle );
+
+    return ( p != links_t::nil() ) && ( m_pool.links().item( p ).m_bucket != EXPIRED );
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+size_t FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::tick( void )
+{
+    size_t ret_val = 0U;
+    tick_t span = wheelSlots;
+
+    m_now++;
+
+    /* Each time a level wraps around, bring down the timers from the next
+       bucket of the level above */
+    for( size_t level = 1U;
+         ( level < wheelLevels ) && ( ( m_now & ( span - 1U ) ) == 0U );
+         level++ )
+    {
+        cascade( ( level * wheelSlots ) + ( ( m_now / span ) & ( wheelSlots - 1U ) ) );
+        span *= wheelSlots;
+    }
+
+    /* Everything in the current bucket of level 0 expires now */
+    size_t bucket = m_now & ( wheelSlots - 1U );
+    link_t p = m_buckets[ bucket ];
+
+    m_buckets[ bucket ] = links_t::nil();
+
+    while( p != links_t::nil() )
+    {
+        link_t next = m_pool.links().next( p );
+        insert_expired( p );
+        ret_val++;
+        p = next;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+size_t FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::advance( const tick_t p_ticks )
+{
+    size_t ret_val = 0U;
+
+    for( tick_t i = 0U;
+         i < p_ticks;
+         i++ )
+    {
+        ret_val += tick();
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+bool FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::expired( T* const p_item )
+{
+    bool ret_val = false;
+    link_t p = m_buckets[ EXPIRED ];
+
+    if( p != links_t::nil() )
+    {
+        if( p_item != NULL )
+        {
+            *p_item = m_pool.links().item( p ).m_value;
+        }
+
+        unlink( p );
+        release( p );
+
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+typename FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::tick_t FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::now( void ) const
+{
+    return m_now;
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+size_t FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::used( void ) const
+{
+    return m_pool.used();
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+size_t FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::available( void ) const
+{
+    return m_pool.available();
+}
+
+template < class T, size_t timerMax, size_t wheelSlots, size_t wheelLevels >
+void FixedLengthTimerWheel< T, timerMax, wheelSlots, wheelLevels >::clear( void )
+{
+    for( size_t i = 0;
+         i <= EXPIRED;
+         i++ )
+    {
+        link_t p = m_buckets[ i ];
+
+        m_buckets[ i ] = links_t::nil();
+
+        while( p != links_t::nil() )
+        {
+            link_t next = m_pool.links().next( p );
+            release( p );
+            p = next;
+        }
+    }
+
+    m_expiredTail = links_t::nil();
+}
+
+#endif
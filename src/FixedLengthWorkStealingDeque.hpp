@@ -0,0 +1,379 @@
+/**
+   @file
+   @brief Template class ( FixedLengthWorkStealingDeque ) to implement a
+          lock-free work-stealing deque with a limited number of elements,
+          owned by one thread from which other threads may steal.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDLENGTHWORKSTEALINGDEQUE_HPP
+#define      FIXEDLENGTHWORKSTEALINGDEQUE_HPP
+
+#include <cstddef> // for size_t, ptrdiff_t
+#include <cstring> // for memcpy()
+#include <stdint.h> // for uint64_t
+#include <atomic>
+#include <type_traits>
+
+#ifndef FIXEDLENGTH_CACHE_LINE_SIZE
+/** Size of a cache line, used to keep data written by different threads
+    apart.  May be overridden to suit the target */
+#define FIXEDLENGTH_CACHE_LINE_SIZE (64U)
+#endif
+
+/**
+   Template class to implement a deque with a fixed maximum number of
+   elements, for use as a per-thread task queue in a work-stealing
+   scheduler.  One thread (the owner) adds and removes items at the front
+   of the deque with push() and pop(), while any number of other threads
+   (thieves) take items from the back with dequeue() - the same semantics
+   as a FixedLengthList used this way, without the lock.
+
+   This is the Chase-Lev deque, with a fixed circular array and the memory
+   ordering given by Le, Pop, Cohen and Zappa Nardelli ("Correct and
+   Efficient Work-Stealing for Weak Memory Models", PPoPP 2013), so it is
+   correct on weakly ordered targets such as ARM as well as on x86.
+   - push() is wait-free, using no read-modify-write instructions
+   - pop() is wait-free, only using a compare-and-swap when taking the last
+     item, in case a thief is taking it at the same time
+   - dequeue() is lock-free, a thief retrying only in the case that another
+     thread took the item it was after
+
+   Positions are free-running counters, wrapped onto the array by masking
+   in the case that queueMax is a power of two.
+
+   As a thief must copy an item out before it knows whether it has won the
+   race to take it, T must be trivially copyable and is stored as an array
+   of relaxed atomic words, as FixedLengthMPMCList.  Small types (e.g. an
+   index or a pointer to a task) are best suited to this class.
+
+   used() and available() may be called from any thread, but the result is
+   only a snapshot as the other threads may be running concurrently.
+
+   The class requires C++11.
+
+   Example:
+   \code
+          #define WORKERS (4U)
+          FixedLengthWorkStealingDeque< Task*, 256 > tasks[ WORKERS ];
+
+          // Worker w
+          void work( const size_t w ) {
+             Task* t;
+             for( ;; ) {
+                if( tasks[ w ].pop( &t ) ||
+                    tasks[ ( w + 1 ) % WORKERS ].dequeue( &t ) ) {
+                   t->run( tasks[ w ] ); // May push() further tasks
+                }
+             }
+          }
+    \endcode
+*/
+template < class T, size_t queueMax > class FixedLengthWorkStealingDeque
+{
+    /* Pointless to have a deque with no space in it, so the various methods
+       shouldn't have to deal with this situation */
+    static_assert( queueMax > 0, "Deque must have a non-zero length" );
+    static_assert( std::is_trivially_copyable<T>::value, "T must be trivially copyable" );
+
+    private:
+        /** Number of words used to store a T */
+        static const size_t WORDS = ( sizeof( T ) + sizeof( uint64_t ) - 1U ) / sizeof( uint64_t );
+
+        /** An item in the array */
+        struct Item
+        {
+            /** The content/value of the item itself */
+            std::atomic<uint64_t> m_item[ WORDS ];
+        };
+
+        /** Position of the oldest item, from which thieves take.  Only ever
+            incremented, by compare-and-swap */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<size_t> m_top;
+
+        /** Position after the newest item, at which the owner adds.  Written
+            by the owner only */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) std::atomic<size_t> m_bottom;
+
+        /** Storage for the items */
+        alignas( FIXEDLENGTH_CACHE_LINE_SIZE ) Item m_items[ queueMax ];
+
+        /** Map a position onto a slot within m_items */
+        static size_t slot( const size_t p_pos );
+
+        /** Number of items between two positions.  Negative while pop() is
+            taking the last item */
+        static ptrdiff_t distance( const size_t p_top, const size_t p_bottom );
+
+        /** Copy an item into the slot for a position */
+        void store( const size_t p_pos, const T& p_item );
+
+        /** Copy the words of an item out of the slot for a position */
+        void load( const size_t p_pos, uint64_t* const p_words ) const;
+
+    public:
+        /** Constructor for FixedLengthWorkStealingDeque */
+        FixedLengthWorkStealingDeque( void );
+
+        FixedLengthWorkStealingDeque( const FixedLengthWorkStealingDeque& ) = delete;
+        FixedLengthWorkStealingDeque& operator=( const FixedLengthWorkStealingDeque& ) = delete;
+
+        /**
+           push an item onto the front of the deque.  Must only be called by
+           the owner.  Wait-free
+
+           \param p_item The item to be added to the deque
+           \returns true in the case that the item was added
+                    false in the case that the item was not added (no space) */
+        bool push( const T& p_item );
+
+        /**
+           pop an item from the front of the deque (item is removed and
+           returned), i.e. the item most recently push()ed.  Must only be
+           called by the owner.  Wait-free
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (deque
+                    empty)
+        */
+        bool pop( T* const p_item );
+
+        /**
+           dequeue an item from the back of the deque (item is removed and
+           returned), i.e. the oldest item.  May be called by any thread.
+           Lock-free
+
+           \param p_item Pointer to be populated with the value of the item
+           \returns true in the case that an item was returned
+                    false in the case that an item was not returned (deque
+                    empty)
+        */
+        bool dequeue( T* const p_item );
+
+        /** Used to find out how many items are in the deque
+
+            \returns Number of used items, ranging from 0 to queueMax */
+        size_t used() const;
+
+        /** Used to find out how many slots are still available in the deque
+
+            \returns Number of available slots, ranging from 0 to queueMax */
+        size_t available() const;
+
+        typedef T value_type;
+        typedef T * pointer;
+        typedef T & reference;
+};
+
+
+template < class T, size_t queueMax >
+const size_t FixedLengthWorkStealingDeque< T, queueMax >::WORDS;
+
+template < class T, size_t queueMax >
+FixedLengthWorkStealingDeque< T, queueMax >::FixedLengthWorkStealingDeque( void ) : m_top( 0U ), m_bottom( 0U )
+{
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthWorkStealingDeque< T, queueMax >::slot( const size_t p_pos )
+{
+    size_t ret_val;
+
+    if( ( queueMax & ( queueMax - 1U ) ) == 0U )
+    {
+        ret_val = p_pos & ( queueMax - 1U );
+    }
+    else
+    {
+        ret_val = p_pos % queueMax;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+ptrdiff_t FixedLengthWorkStealingDeque< T, queueMax >::distance( const size_t p_top, const size_t p_bottom )
+{
+    /* Positions are free-running, so the difference is taken modulo 2^n
+       and then treated as signed */
+    return (ptrdiff_t)( p_bottom - p_top );
+}
+
+template < class T, size_t queueMax >
+void FixedLengthWorkStealingDeque< T, queueMax >::store( const size_t p_pos, const T& p_item )
+{
+    uint64_t words[ WORDS ] = { 0 };
+    Item& item = m_items[ slot( p_pos ) ];
+
+    memcpy( words, &p_item, sizeof( T ) );
+    for( size_t w = 0; w < WORDS; w++ ) {
+        item.m_item[ w ].store( words[ w ], std::memory_order_relaxed );
+    }
+}
+
+template < class T, size_t queueMax >
+void FixedLengthWorkStealingDeque< T, queueMax >::load( const size_t p_pos, uint64_t* const p_words ) const
+{
+    const Item& item = m_items[ slot( p_pos ) ];
+
+    for( size_t w = 0; w < WORDS; w++ ) {
+        p_words[ w ] = item.m_item[ w ].load( std::memory_order_relaxed );
+    }
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthWorkStealingDeque< T, queueMax >::push( const T& p_item )
+{
+    bool ret_val = false;
+
+    /* Only the owner writes m_bottom, so no ordering is needed to read it.
+       Acquiring m_top ensures that any thief which has moved past a slot
+       has finished reading it before the slot is overwritten */
+    const size_t bottom = m_bottom.load( std::memory_order_relaxed );
+    const size_t top = m_top.load( std::memory_order_acquire );
+
+    /* Check that there's space in the deque */
+    if( distance( top, bottom ) < (ptrdiff_t)queueMax )
+    {
+        store( bottom, p_item );
+
+        /* Publish the item to thieves */
+        std::atomic_thread_fence( std::memory_order_release );
+        m_bottom.store( bottom + 1U, std::memory_order_relaxed );
+
+        /* Indicate success */
+        ret_val = true;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthWorkStealingDeque< T, queueMax >::pop( T* const p_item )
+{
+    bool ret_val = false;
+    uint64_t words[ WORDS ];
+    const size_t bottom = m_bottom.load( std::memory_order_relaxed ) - 1U;
+
+    /* Claim the newest item, then check whether a thief may be after it
+       too.  The fence orders the claim before the read of m_top, pairing
+       with the fence in dequeue() */
+    m_bottom.store( bottom, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    size_t top = m_top.load( std::memory_order_relaxed );
+
+    if( distance( top, bottom ) >= 0 )
+    {
+        load( bottom, words );
+        ret_val = true;
+
+        /* Last item?  Race any thief for it by moving m_top past it */
+        if( top == bottom )
+        {
+            ret_val = m_top.compare_exchange_strong( top, top + 1U,
+                                                     std::memory_order_seq_cst,
+                                                     std::memory_order_relaxed );
+            m_bottom.store( bottom + 1U, std::memory_order_relaxed );
+        }
+    }
+    else
+    {
+        /* Deque was empty - restore m_bottom */
+        m_bottom.store( bottom + 1U, std::memory_order_relaxed );
+    }
+
+    if( ret_val )
+    {
+        memcpy( p_item, words, sizeof( T ) );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+bool FixedLengthWorkStealingDeque< T, queueMax >::dequeue( T* const p_item )
+{
+    bool ret_val = false;
+    uint64_t words[ WORDS ];
+    size_t top = m_top.load( std::memory_order_acquire );
+
+    for( ;; )
+    {
+        /* Pairs with the fence in pop(), so that the owner and a thief
+           can't both take the last item */
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        const size_t bottom = m_bottom.load( std::memory_order_acquire );
+
+        if( distance( top, bottom ) <= 0 )
+        {
+            /* Deque empty */
+            break;
+        }
+
+        /* Copy the item out before trying to claim it, as once it's claimed
+           the owner could overwrite the slot */
+        load( top, words );
+
+        if( m_top.compare_exchange_strong( top, top + 1U,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed ) )
+        {
+            ret_val = true;
+            break;
+        }
+
+        /* Lost the race to another thread, which has moved m_top on (and
+           top has been updated with its new value) - try again */
+    }
+
+    if( ret_val )
+    {
+        memcpy( p_item, words, sizeof( T ) );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthWorkStealingDeque< T, queueMax >::used() const
+{
+    /* Either position may move between the two reads, so clamp the
+       result */
+    const size_t top = m_top.load( std::memory_order_acquire );
+    const ptrdiff_t count = distance( top, m_bottom.load( std::memory_order_acquire ) );
+    size_t ret_val = 0U;
+
+    if( count > 0 )
+    {
+        ret_val = ( (size_t)count > queueMax ) ? queueMax : (size_t)count;
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t queueMax >
+size_t FixedLengthWorkStealingDeque< T, queueMax >::available() const
+{
+    return queueMax - used();
+}
+
+#endif
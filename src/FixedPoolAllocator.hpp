@@ -0,0 +1,244 @@
+/**
+   @file
+   @brief Template class ( FixedPoolAllocator ) implementing a standard
+          allocator which takes single objects from a fixed size pool.
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if !defined FIXEDPOOLALLOCATOR_HPP
+#define      FIXEDPOOLALLOCATOR_HPP
+
+#include <cstddef> // for size_t, ptrdiff_t, NULL
+#include <functional> // for less
+#include <new> // for operator new, placement new
+
+#include "FixedLengthPool.hpp"
+
+/**
+   Allocator, meeting the standard library's allocator requirements, which
+   takes objects one at a time from a fixed size pool of poolMax items using
+   the same free stack as FixedLengthList - allocation and deallocation are
+   both constant time and touch only the pool.
+
+   This suits the node based containers (std::list, std::map, std::set,
+   std::unordered_map, etc), which allocate each node individually.  The
+   container rebinds the allocator to its node type, and each type T that
+   the allocator is bound to has its own static pool of poolMax objects,
+   shared by all containers using that type.  The pools are created on first
+   use, in constant time.  As the allocator itself holds no state all
+   instances compare equal, so containers may be swapped or spliced freely.
+
+   Requests which the pool can't satisfy fall back to ::operator new (and
+   hence throw std::bad_alloc on failure, as required of an allocator):
+   - requests for more than one object at a time, e.g. the bucket array of
+     std::unordered_map or the storage of std::vector.  Calling reserve()
+     up front limits these to one allocation at start-up
+   - requests made once the pool is exhausted
+   overflows() counts these, so that a pool which is too small can be
+   detected.
+
+   Example:
+   \code
+          typedef std::pair< const int, Order > entry_t;
+
+          // Up to 1024 orders without touching the heap
+          std::map< int, Order, std::less< int >,
+                    FixedPoolAllocator< entry_t, 1024 > > orders;
+   \endcode
+
+   Note that the class currently is not thread safe.
+*/
+template < class T, size_t poolMax > class FixedPoolAllocator
+{
+    public:
+        typedef T value_type;
+        typedef T * pointer;
+        typedef const T * const_pointer;
+        typedef T & reference;
+        typedef const T & const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        /** Equivalent allocator for objects of type U, drawing from a pool
+            of poolMax objects of that type */
+        template < class U > struct rebind
+        {
+            typedef FixedPoolAllocator< U, poolMax > other;
+        };
+
+        /** Constructor for FixedPoolAllocator */
+        FixedPoolAllocator( void ) {}
+
+        /** Construct from an allocator for another type */
+        template < class U > FixedPoolAllocator( const FixedPoolAllocator< U, poolMax >& p_other ) {}
+
+        /** Retrieve the address of p_item */
+        pointer address( reference p_item ) const { return &p_item; }
+
+        /** Retrieve the address of p_item */
+        const_pointer address( const_reference p_item ) const { return &p_item; }
+
+        /**
+           Allocate storage for p_count objects.  The objects are not
+           constructed
+
+           \param p_count Number of objects
+           \param p_hint Unused
+           \returns Pointer to the storage
+        */
+        pointer allocate( const size_type p_count, const void* p_hint = NULL );
+
+        /**
+           Release storage obtained from allocate().  Any objects must already
+           have been destroyed
+
+           \param p_ptr Storage to be released
+           \param p_count Number of objects, as passed to allocate()
+        */
+        void deallocate( const pointer p_ptr, const size_type p_count );
+
+        /** Retrieve the largest number of objects which may be passed to
+            allocate() */
+        size_type max_size( void ) const { return ( (size_type)-1 ) / sizeof( T ); }
+
+#if FIXEDLENGTHLIST_CXX11
+        /** Construct an object in storage obtained from allocate() */
+        template < class U, class... Args > void construct( U* const p_ptr, Args&&... p_args ) { ::new( static_cast<void*>( p_ptr ) ) U( std::forward< Args >( p_args )... ); }
+
+        /** Destroy an object without releasing its storage */
+        template < class U > void destroy( U* const p_ptr ) { p_ptr->~U(); }
+#else
+        /** Construct an object in storage obtained from allocate() */
+        void construct( const pointer p_ptr, const T& p_val ) { ::new( static_cast<void*>( p_ptr ) ) T( p_val ); }
+
+        /** Destroy an object without releasing its storage */
+        void destroy( const pointer p_ptr ) { p_ptr->~T(); }
+#endif
+
+        /** Used to find out how many objects of type T are allocated from the
+            pool
+
+            \returns Number of used objects, ranging from 0 to poolMax */
+        static size_t used( void ) { return pool().used(); }
+
+        /** Used to find out how many more objects of type T may be allocated
+            from the pool
+
+            \returns Number of available objects, ranging from 0 to poolMax */
+        static size_t available( void ) { return pool().available(); }
+
+        /** Used to find out how many allocations of type T have been passed
+            on to ::operator new since the program started
+
+            \returns Number of allocations not satisfied by the pool */
+        static size_t overflows( void ) { return overflow_count(); }
+
+    private:
+        /** Type of pool holding the objects.  Index links keep the objects
+            in a single array, so an object's position is found from its
+            address */
+        typedef FixedLengthPool< T, poolMax, FixedLengthListCompactSingleLinks > pool_t;
+
+        /** Retrieve the pool for objects of type T, creating it on first use
+            so that it is ready even for containers constructed during static
+            initialisation */
+        static pool_t& pool( void )
+        {
+            static pool_t s_pool;
+            return s_pool;
+        }
+
+        /** Number of allocations passed on to ::operator new */
+        static size_t& overflow_count( void )
+        {
+            static size_t s_overflows = 0U;
+            return s_overflows;
+        }
+};
+
+template < class T, size_t poolMax >
+typename FixedPoolAllocator< T, poolMax >::pointer FixedPoolAllocator< T, poolMax >::allocate( const size_type p_count, const void* p_hint )
+{
+    pointer ret_val = NULL;
+
+    if( p_count == 1U )
+    {
+        pool_t& p = pool();
+        typename pool_t::link_t l = p.allocate();
+
+        if( l != pool_t::links_t::nil() )
+        {
+            ret_val = &( p.links().item( l ) );
+        }
+    }
+
+    if( ret_val == NULL )
+    {
+        overflow_count()++;
+        ret_val = static_cast< pointer >( ::operator new( p_count * sizeof( T ) ) );
+    }
+
+    return ret_val;
+}
+
+template < class T, size_t poolMax >
+void FixedPoolAllocator< T, poolMax >::deallocate( const pointer p_ptr, const size_type p_count )
+{
+    const unsigned char* const obj = reinterpret_cast< const unsigned char* >( p_ptr );
+    bool pooled = false;
+
+    if( p_count == 1U )
+    {
+        const pool_t& p = pool();
+        const unsigned char* const base = reinterpret_cast< const unsigned char* >( p.links().values() );
+        /* Items are held in slots, which in C++03 may be padded */
+        const size_t stride = sizeof( FixedLengthListSlot< T > );
+
+        /* std::less gives a total order, even for pointers outside the
+           pool */
+        if( !std::less< const unsigned char* >()( obj, base ) &&
+            std::less< const unsigned char* >()( obj, base + ( poolMax * stride ) ) )
+        {
+            pool().release( p.links().slot( (size_t)( obj - base ) / stride ) );
+            pooled = true;
+        }
+    }
+
+    if( !pooled )
+    {
+        ::operator delete( static_cast< void* >( p_ptr ) );
+    }
+}
+
+/** All FixedPoolAllocators with the same pool size are interchangeable */
+template < class T, class U, size_t poolMax >
+bool operator==( const FixedPoolAllocator< T, poolMax >& p_a, const FixedPoolAllocator< U, poolMax >& p_b )
+{
+    return true;
+}
+
+template < class T, class U, size_t poolMax >
+bool operator!=( const FixedPoolAllocator< T, poolMax >& p_a, const FixedPoolAllocator< U, poolMax >& p_b )
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,202 @@
+/**
+   @file
+   @brief Tests for the FixedLengthBlockingList class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+
+#include "FixedLengthBlockingList.hpp"
+
+#define LIST_LEN (8U)
+#define WAITERS (3U)
+#define PRODUCERS (2U)
+#define CONSUMERS (3U)
+#define ITEM_COUNT (200000U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+FixedLengthBlockingList<unsigned,  LIST_LEN > list;
+
+static void check_timeouts( void );
+static void check_wakeups( void );
+static void check_threaded( void );
+
+int main() {
+    unsigned i = 0;
+    unsigned items[ LIST_LEN ];
+    bool ok = true;
+    PRINTF("FixedLengthBlockingList test\n");
+
+    /* Test operations which don't wait */
+    CHECK( list.used() == 0 && list.available() == LIST_LEN, "Initial used() & available()" );
+    CHECK( list.pop( &i ) == false && list.pop_n( items, LIST_LEN ) == 0, "pop() & pop_n() on empty list" );
+
+    for( unsigned n = 0; n < LIST_LEN; n++ ) {
+        ok = ok && list.queue( n );
+    }
+    CHECK( ok && list.queue( 99 ) == false && list.available() == 0, "queue() until full" );
+    CHECK( list.pop( &i ) && i == 0, "pop() yielded correct value" );
+    CHECK( list.pop_n( items, 3 ) == 3 && items[ 0 ] == 1 && items[ 2 ] == 3, "pop_n() yielded correct values" );
+
+    /* Items available, so no waiting */
+    list.queue_wait( 8 );
+    CHECK( list.used() == 5, "queue_wait() with space" );
+    list.pop_wait( &i );
+    CHECK( i == 4, "pop_wait() with item available" );
+    CHECK( list.pop_wait_n( items, LIST_LEN ) == 4 && items[ 3 ] == 8 && list.used() == 0, "pop_wait_n() takes all available" );
+
+    check_timeouts();
+    check_wakeups();
+    check_threaded();
+
+    PRINTF("FixedLengthBlockingList test - Done\n");
+
+    return 0;
+}
+
+static void check_timeouts( void )
+{
+    const std::chrono::milliseconds timeout( 20 );
+    unsigned i = 0;
+    unsigned items[ LIST_LEN ];
+    bool ok = true;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    CHECK( list.pop_wait_for( &i, timeout ) == false && ( std::chrono::steady_clock::now() - start ) >= timeout, "pop_wait_for() times out on empty list" );
+    start = std::chrono::steady_clock::now();
+    CHECK( list.pop_wait_n_for( items, LIST_LEN, timeout ) == 0 && ( std::chrono::steady_clock::now() - start ) >= timeout, "pop_wait_n_for() times out on empty list" );
+
+    for( unsigned n = 0; n < LIST_LEN; n++ ) {
+        ok = ok && list.queue_wait_for( n, timeout );
+    }
+    CHECK( ok, "queue_wait_for() with space" );
+    start = std::chrono::steady_clock::now();
+    CHECK( list.queue_wait_for( 99, timeout ) == false && ( std::chrono::steady_clock::now() - start ) >= timeout && list.used() == LIST_LEN, "queue_wait_for() times out on full list" );
+
+    CHECK( list.pop_wait_for( &i, timeout ) && i == 0, "pop_wait_for() with item available" );
+    CHECK( list.pop_wait_n_for( items, LIST_LEN, timeout ) == LIST_LEN - 1 && list.used() == 0, "pop_wait_n_for() with items available" );
+}
+
+static void check_wakeups( void )
+{
+    std::vector< std::thread > threads;
+    std::atomic< unsigned > woken( 0U );
+    unsigned i = 0;
+
+    /* Several consumers wait on an empty list.  Items queued in quick
+       succession only signal once, on the first, yet each consumer must get
+       an item */
+    for( unsigned t = 0; t < WAITERS; t++ ) {
+        threads.push_back( std::thread( [&woken]() {
+            unsigned v;
+            list.pop_wait( &v );
+            woken.fetch_add( 1U );
+        } ) );
+    }
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    for( unsigned t = 0; t < WAITERS; t++ ) {
+        list.queue( t );
+    }
+    for( size_t t = 0; t < threads.size(); t++ ) {
+        threads[ t ].join();
+    }
+    threads.clear();
+    CHECK( woken.load() == WAITERS && list.used() == 0, "pop_wait(): every waiting consumer woken" );
+
+    /* Likewise producers waiting on a full list */
+    for( unsigned n = 0; n < LIST_LEN; n++ ) {
+        list.queue( n );
+    }
+    woken.store( 0U );
+    for( unsigned t = 0; t < WAITERS; t++ ) {
+        threads.push_back( std::thread( [&woken, t]() {
+            list.queue_wait( 100U + t );
+            woken.fetch_add( 1U );
+        } ) );
+    }
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    CHECK( woken.load() == 0U, "queue_wait(): producers wait on full list" );
+    for( unsigned t = 0; t < WAITERS; t++ ) {
+        list.pop( &i );
+    }
+    for( size_t t = 0; t < threads.size(); t++ ) {
+        threads[ t ].join();
+    }
+    CHECK( woken.load() == WAITERS && list.used() == LIST_LEN, "queue_wait(): every waiting producer woken" );
+
+    while( list.pop( &i ) ) {
+    }
+}
+
+static void check_threaded( void )
+{
+    static std::atomic< unsigned char > taken[ ITEM_COUNT ];
+    std::vector< std::thread > threads;
+    std::atomic< unsigned > consumed( 0U );
+    bool once = true;
+
+    for( unsigned n = 0; n < ITEM_COUNT; n++ ) {
+        taken[ n ].store( 0U, std::memory_order_relaxed );
+    }
+
+    /* Producers queue, waiting when full, while consumers take one item or
+       a batch at a time - every item must be taken exactly once */
+    for( unsigned t = 0; t < PRODUCERS; t++ ) {
+        threads.push_back( std::thread( [t]() {
+            for( unsigned n = t; n < ITEM_COUNT; n += PRODUCERS ) {
+                list.queue_wait( n );
+            }
+        } ) );
+    }
+    for( unsigned t = 0; t < CONSUMERS; t++ ) {
+        threads.push_back( std::thread( [t, &consumed]() {
+            unsigned items[ LIST_LEN ];
+            size_t count;
+            while( consumed.load() < ITEM_COUNT ) {
+                if( t == 0U ) {
+                    count = list.pop_wait_for( items, std::chrono::milliseconds( 5 ) ) ? 1U : 0U;
+                } else {
+                    count = list.pop_wait_n_for( items, LIST_LEN, std::chrono::milliseconds( 5 ) );
+                }
+                for( size_t k = 0; k < count; k++ ) {
+                    taken[ items[ k ] ].fetch_add( 1U, std::memory_order_relaxed );
+                }
+                consumed.fetch_add( (unsigned)count );
+            }
+        } ) );
+    }
+
+    for( size_t t = 0; t < threads.size(); t++ ) {
+        threads[ t ].join();
+    }
+
+    for( unsigned n = 0; n < ITEM_COUNT; n++ ) {
+        once = once && ( taken[ n ].load( std::memory_order_relaxed ) == 1U );
+    }
+
+    CHECK( once && consumed.load() == ITEM_COUNT, "threaded: every item taken exactly once" );
+    CHECK( list.used() == 0, "threaded: list empty after transfer" );
+}
@@ -0,0 +1,140 @@
+/**
+   @file
+   @brief Tests for the FixedLengthHistory class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include "FixedLengthHistory.hpp"
+
+#define HISTORY_LEN (6U)
+#define POW2_HISTORY_LEN (8U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+FixedLengthHistory<int,  HISTORY_LEN > history;
+FixedLengthHistory<int,  POW2_HISTORY_LEN > pow2_history;
+
+template < size_t queueMax > static void check_readers( FixedLengthHistory< int, queueMax >& p_history, const char* p_name );
+
+int main() {
+    int i = 0;
+    uint64_t seq = 99U;
+    bool ok = true;
+    PRINTF("FixedLengthHistory test\n");
+
+    /* Test operations on an empty history */
+    CHECK( history.used() == 0 && history.available() == HISTORY_LEN, "Initial used() & available()" );
+    CHECK( history.first_seq() == 0 && history.next_seq() == 0, "Initial sequence numbers" );
+    CHECK( history.pop( &i ) == false && history.get( 0, &i ) == false, "pop() & get() on empty history" );
+
+    /* Fill the history */
+    for( int n = 0; n < (int)HISTORY_LEN; n++ ) {
+        ok = ok && !history.queue( 100 + n );
+    }
+    CHECK( ok && history.used() == HISTORY_LEN && history.available() == 0, "queue() until full, nothing overwritten" );
+    CHECK( history.first_seq() == 0 && history.next_seq() == HISTORY_LEN, "Sequence numbers once full" );
+
+    /* Queueing onto a full history overwrites the oldest item */
+    i = -1;
+    CHECK( history.queue( 200 ) && history.used() == HISTORY_LEN, "queue() on full history overwrites" );
+    CHECK( history.queue( 201, &i ) && i == 101, "queue() on full history returns overwritten item" );
+    CHECK( history.first_seq() == 2 && history.next_seq() == HISTORY_LEN + 2, "Sequence numbers after overwrite" );
+    CHECK( history.get( 1, &i ) == false && history.get( HISTORY_LEN + 2, &i ) == false, "get() outside of the items held" );
+    CHECK( history.get( 2, &i ) && i == 102 && history.get( HISTORY_LEN + 1, &i ) && i == 201, "get() oldest & newest items" );
+
+    CHECK( history.pop( &i, &seq ) && i == 102 && seq == 2, "pop() returns oldest item & its sequence number" );
+    CHECK( history.pop( &i ) && i == 103 && history.first_seq() == 4 && history.available() == 2, "pop() without sequence number" );
+    CHECK( !history.queue( 202 ) && history.get( HISTORY_LEN + 2, &i ) && i == 202, "queue() into space freed by pop()" );
+
+    history.clear();
+    CHECK( history.used() == 0 && history.first_seq() == HISTORY_LEN + 3 && history.next_seq() == HISTORY_LEN + 3, "clear() keeps sequence numbers" );
+    CHECK( !history.queue( 300 ) && history.get( HISTORY_LEN + 3, &i ) && i == 300, "queue() after clear()" );
+
+    check_readers( history, "non-power of 2" );
+    check_readers( pow2_history, "power of 2" );
+
+    PRINTF("FixedLengthHistory test - Done\n");
+
+    return 0;
+}
+
+/* Two readers follow a history as it is written - one keeping up, one
+   falling behind and missing items */
+template < size_t queueMax > static void check_readers( FixedLengthHistory< int, queueMax >& p_history, const char* p_name )
+{
+    uint64_t fast = p_history.next_seq();
+    uint64_t slow = fast;
+    uint64_t start = fast;
+    int out[ queueMax * 2U ];
+    const int* run = NULL;
+    size_t count;
+    bool ok = true;
+
+    PRINTF( "Readers, %s\n", p_name );
+
+    for( int n = 0; n < 1000; n++ ) {
+        p_history.queue( n );
+
+        /* The fast reader takes one item at a time */
+        count = p_history.read_since( &fast, out, 1U );
+        ok = ok && ( count == 1U ) && ( out[ 0 ] == n ) && ( fast == p_history.next_seq() );
+    }
+    CHECK( ok && p_history.read_since( &fast, out, queueMax ) == 0U, "read_since(): keeping up" );
+
+    /* The slow reader has missed all but the last queueMax items */
+    CHECK( slow < p_history.first_seq() && p_history.first_seq() == start + 1000U - queueMax, "read_since(): items missed" );
+    count = p_history.read_since( &slow, out, queueMax * 2U );
+    ok = ( count == queueMax ) && ( slow == p_history.next_seq() );
+    for( size_t k = 0; k < count; k++ ) {
+        ok = ok && ( out[ k ] == (int)( 1000U - queueMax + k ) );
+    }
+    CHECK( ok, "read_since(): resumes at oldest item" );
+
+    /* Part way through, limited by p_max */
+    slow = p_history.next_seq() - 3U;
+    CHECK( p_history.read_since( &slow, out, 2U ) == 2U && out[ 0 ] == 997 && out[ 1 ] == 998 && slow == p_history.next_seq() - 1U, "read_since(): limited by p_max" );
+
+    /* The whole history without copying, in at most two runs */
+    {
+        uint64_t cursor = 0U;
+        int expect = 1000 - (int)queueMax;
+        unsigned runs = 0U;
+
+        ok = true;
+        while( ( count = p_history.peek_since( cursor, &run ) ) > 0U ) {
+            for( size_t k = 0; k < count; k++ ) {
+                ok = ok && ( run[ k ] == expect++ );
+            }
+            cursor = std::max( cursor, p_history.first_seq() ) + count;
+            runs++;
+        }
+        CHECK( ok && expect == 1000 && runs >= 1U && runs <= 2U && cursor == p_history.next_seq(), "peek_since(): all items in order" );
+    }
+    CHECK( p_history.peek_since( p_history.next_seq(), &run ) == 0U && p_history.peek_since( p_history.next_seq() + 5U, &run ) == 0U, "peek_since(): nothing new" );
+}
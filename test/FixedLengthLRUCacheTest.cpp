@@ -0,0 +1,236 @@
+/**
+   @file
+   @brief Tests for the FixedLengthLRUCache class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include <string>
+
+#include "FixedLengthLRUCache.hpp"
+
+#define CACHE_LEN (4U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+struct IntHash
+{
+    size_t operator()( const int p_val ) const { return (size_t)p_val * 2654435761U; }
+};
+
+/* Poor hash, forcing long probe sequences */
+struct CollidingHash
+{
+    size_t operator()( const int p_val ) const { return (size_t)( p_val & 1 ); }
+};
+
+/* Counts the empty keys it's asked to hash.  None of the keys are empty,
+   so any such is a key which has already been moved from, which would
+   start the index's probe in the wrong bucket */
+struct StringHash
+{
+    static unsigned s_emptyHashed;
+    size_t operator()( const std::string& p_val ) const {
+        size_t ret_val = 5381U;
+        if( p_val.empty() ) {
+            s_emptyHashed++;
+        }
+        for( size_t i = 0; i < p_val.size(); i++ ) {
+            ret_val = ( ret_val * 33U ) ^ (unsigned char)p_val[ i ];
+        }
+        return ret_val;
+    }
+};
+unsigned StringHash::s_emptyHashed = 0U;
+
+FixedLengthLRUCache<int, int, CACHE_LEN, IntHash > cache;
+
+static void check_against_reference( void );
+static void check_string_keys( void );
+
+int main() {
+    int i = 0;
+    int k = 0;
+    PRINTF("FixedLengthLRUCache test\n");
+
+    /* Test operations on an empty cache */
+    CHECK( cache.used() == 0, "Initial used()" );
+    CHECK( cache.available() == CACHE_LEN, "Initial available()" );
+    CHECK( cache.get( 1, &i ) == false, "get() on empty cache" );
+    CHECK( cache.misses() == 1 && cache.hits() == 0, "get() miss counted" );
+    CHECK( cache.peek( 1 ) == NULL && !cache.contains( 1 ), "peek() & contains() on empty cache" );
+
+    CHECK( cache.put( 1, 10 ) == false && cache.put( 2, 20 ) == false, "put()" );
+    CHECK( cache.used() == 2, "used() after put()" );
+    CHECK( cache.get( 1, &i ) && i == 10, "get() yields value" );
+    CHECK( cache.hits() == 1 && cache.misses() == 1, "get() hit counted" );
+    CHECK( cache.put( 2, 21 ) == false && cache.used() == 2 && cache.get( 2, &i ) && i == 21, "put() replaces value" );
+
+    /* Order of use (most recent first) is now 2, 1 */
+    cache.put( 3, 30 );
+    cache.put( 4, 40 );
+    CHECK( cache.available() == 0, "available() on full cache" );
+    CHECK( cache.put( 5, 50, &k, &i ) && k == 1 && i == 10, "put() on full cache discards least recently used" );
+    CHECK( !cache.contains( 1 ) && cache.contains( 5 ) && cache.used() == CACHE_LEN, "discarded entry gone" );
+
+    /* Order is now 5, 4, 3, 2 - touching 2 makes 3 the least recently used */
+    CHECK( cache.get( 2, &i ) && i == 21, "get() least recently used entry" );
+    CHECK( cache.put( 6, 60, &k ) && k == 3, "put() discards entry after get()" );
+
+    /* Order is now 6, 2, 5, 4 - peek() must not change it */
+    CHECK( cache.peek( 4 ) != NULL && *cache.peek( 4 ) == 40, "peek() yields value" );
+    CHECK( cache.put( 7, 70, &k ) && k == 4, "peek() does not affect order of use" );
+
+    CHECK( cache.remove( 5 ) && !cache.contains( 5 ) && cache.used() == 3, "remove()" );
+    CHECK( cache.remove( 5 ) == false, "remove() of key not in cache" );
+    CHECK( cache.put( 8, 80 ) == false && cache.used() == CACHE_LEN, "put() reuses removed entry" );
+
+    cache.reset_stats();
+    CHECK( cache.hits() == 0 && cache.misses() == 0, "reset_stats()" );
+    cache.clear();
+    CHECK( cache.used() == 0 && !cache.contains( 8 ) && cache.get( 2, &i ) == false, "clear()" );
+    CHECK( cache.put( 2, 22 ) == false && cache.get( 2, &i ) && i == 22, "put() after clear()" );
+
+    check_against_reference();
+    check_string_keys();
+
+    PRINTF("FixedLengthLRUCache test - Done\n");
+
+    return 0;
+}
+
+/* Apply the same pseudo-random sequence of operations to a cache and a
+   simple array kept in order of use, checking that they agree */
+template < class Hash > static bool matches_reference( void )
+{
+    FixedLengthLRUCache<int, int, 16U, Hash > c;
+    int keys[ 16 ];
+    int vals[ 16 ];
+    size_t count = 0;
+    unsigned seed = 3U;
+    bool ok = true;
+
+    for( unsigned n = 0; n < 5000U; n++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+        unsigned r = seed >> 16;
+        int key = (int)( ( r >> 2 ) % 40U );
+        size_t j;
+        int v;
+
+        /* Find key in the reference (index 0 is most recently used) */
+        for( j = 0; ( j < count ) && ( keys[ j ] != key ); j++ ) {
+        }
+
+        switch( r % 3U )
+        {
+            case 0:
+            {
+                int ek = -1;
+                bool evicted = c.put( key, (int)n, &ek );
+                if( j == count ) {
+                    ok = ok && ( evicted == ( count == 16U ) );
+                    if( count == 16U ) {
+                        ok = ok && ( ek == keys[ 15 ] );
+                        count--;
+                    }
+                    j = count++;
+                }
+                /* Move to front */
+                for( ; j > 0; j-- ) {
+                    keys[ j ] = keys[ j - 1U ];
+                    vals[ j ] = vals[ j - 1U ];
+                }
+                keys[ 0 ] = key;
+                vals[ 0 ] = (int)n;
+                break;
+            }
+            case 1:
+                ok = ok && ( c.get( key, &v ) == ( j < count ) );
+                if( j < count ) {
+                    ok = ok && ( v == vals[ j ] );
+                    int kv = vals[ j ];
+                    for( ; j > 0; j-- ) {
+                        keys[ j ] = keys[ j - 1U ];
+                        vals[ j ] = vals[ j - 1U ];
+                    }
+                    keys[ 0 ] = key;
+                    vals[ 0 ] = kv;
+                }
+                break;
+            default:
+                ok = ok && ( c.remove( key ) == ( j < count ) );
+                if( j < count ) {
+                    for( ; j + 1U < count; j++ ) {
+                        keys[ j ] = keys[ j + 1U ];
+                        vals[ j ] = vals[ j + 1U ];
+                    }
+                    count--;
+                }
+                break;
+        }
+
+        ok = ok && ( c.used() == count );
+    }
+
+    return ok;
+}
+
+static void check_against_reference( void )
+{
+    CHECK( matches_reference< IntHash >(), "agrees with reference" );
+    CHECK( matches_reference< CollidingHash >(), "agrees with reference with colliding hash" );
+}
+
+/* Long enough that moving one leaves it empty, rather than copying it in
+   place */
+static std::string long_key( const int p_val )
+{
+    char buf[ 48 ];
+    sprintf( buf, "key %d, long enough not to be held in place", p_val );
+    return std::string( buf );
+}
+
+static void check_string_keys( void )
+{
+    FixedLengthLRUCache<std::string, int, CACHE_LEN, StringHash > scache;
+    std::string k;
+    int i = 0;
+    bool ok = true;
+
+    for( int n = 0; n < (int)CACHE_LEN; n++ ) {
+        scache.put( long_key( n ), n );
+    }
+    StringHash::s_emptyHashed = 0U;
+
+    for( int n = (int)CACHE_LEN; n < (int)CACHE_LEN * 3; n++ ) {
+        ok = ok && scache.put( long_key( n ), n, &k, &i ) && k == long_key( n - (int)CACHE_LEN ) && i == n - (int)CACHE_LEN;
+        ok = ok && !scache.contains( k ) && scache.contains( long_key( n ) );
+    }
+    CHECK( ok && StringHash::s_emptyHashed == 0U, "string keys: evicted key not hashed once moved from" );
+}
@@ -31,7 +31,13 @@ Serial pc(USBTX, USBRX); // tx, rx
 #define PRINTF( ... ) printf(__VA_ARGS__)
 #endif
 
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string.h>
+
 #include "FixedLengthList.hpp"
+#include "FixedLengthListScanIndex.hpp"
    
 #define LIST_LEN (20U)
 #define LIST2_INI (17U)
@@ -42,13 +48,40 @@ Serial pc(USBTX, USBRX); // tx, rx
 int init_list[ LIST2_INI ] = { 12, 23, 34, 45, 56, 67, 78, 89, 100, 111,
                                122, 133, 144, 155, 166, 177, 188, };
 
-FixedLengthList<int,  LIST_LEN > list;
+/* Must be initialised at compile time, where this can be checked */
+FIXEDLENGTHLIST_CONSTINIT FixedLengthList<int,  LIST_LEN > list;
 FixedLengthList<int,  LIST_LEN > list2( init_list, LIST2_INI );
+
+#if FIXEDLENGTHLIST_CXX14
+/* Lists fully built at compile time.  FIXEDLENGTHLIST_CONSTINIT makes it an
+   error should any of them need constructing at start up */
+const int const_init_list[ LIST2_INI ] = { 12, 23, 34, 45, 56, 67, 78, 89, 100, 111,
+                                           122, 133, 144, 155, 166, 177, 188, };
+
+FIXEDLENGTHLIST_CONSTINIT FixedLengthList<int,  LIST_LEN > static_single( const_init_list );
+FIXEDLENGTHLIST_CONSTINIT FixedLengthList<int,  LIST_LEN, FixedLengthListDoubleLinks > static_double( const_init_list );
+FIXEDLENGTHLIST_CONSTINIT FixedLengthList<int,  LIST_LEN, FixedLengthListCompactSingleLinks > static_compact_single( const_init_list );
+FIXEDLENGTHLIST_CONSTINIT FixedLengthList<int,  LIST_LEN, FixedLengthListCompactDoubleLinks > static_compact_double( const_init_list );
+#endif
 #if 0
 FixedLengthList<char, LIST_LEN > list3;
 #endif
 
 static void check_iterators( void );
+static void check_doubly_linked( void );
+static void check_compact_links( void );
+static void check_object_lifetime( void );
+static void check_batch( void );
+static void check_lazy_init( void );
+static void check_hash_index( void );
+static void check_hash_index_strings( void );
+static void check_scan_index( void );
+static void check_stats( void );
+static void check_erase_insert( void );
+static void check_compact( void );
+static void check_static_init( void );
+static void check_snapshot( void );
+static void check_overwrite( void );
    
 int main() {
     int i = 0;
@@ -143,6 +176,19 @@ int main() {
     CHECK( list2.queue( 254 ) == false,   "queue() on a full list" );
     
     check_iterators();
+    check_doubly_linked();
+    check_compact_links();
+    check_object_lifetime();
+    check_batch();
+    check_lazy_init();
+    check_hash_index();
+    check_scan_index();
+    check_stats();
+    check_erase_insert();
+    check_compact();
+    check_static_init();
+    check_snapshot();
+    check_overwrite();
     
     CHECK( list2.remove( 255 ) == false,  "remove() a non-existant item" );
     CHECK( list2.available() == 0, "available() having tried to remove non-existent item from full list" ); 
@@ -174,3 +220,994 @@ static void check_iterators( void )
 
 }
 
+static void check_doubly_linked( void )
+{
+    FixedLengthList<int,  LIST_LEN, FixedLengthListDoubleLinks > dlist( init_list, LIST2_INI );
+    FixedLengthList<int,  LIST_LEN, FixedLengthListDoubleLinks >::iterator it;
+    int i = 0;
+
+    CHECK( dlist.used() == LIST2_INI, "doubly linked: used() after initialising constructor" );
+    CHECK( dlist.dequeue(&i) == true, "doubly linked: dequeue() returned OK" );
+    CHECK( i == 188,       "doubly linked: dequeue() yielded correct value" );
+    CHECK( dlist.dequeue(&i) == true, "doubly linked: dequeue() returned OK" );
+    CHECK( i == 177,       "doubly linked: dequeue() yielded correct value" );
+    CHECK( dlist.pop(&i) == true, "doubly linked: pop() returned OK" );
+    CHECK( i == 12,        "doubly linked: pop() yielded correct value" );
+
+    /* Remove from the middle, the head and the tail, then check that the
+       remaining items are still correctly linked in both directions */
+    CHECK( dlist.remove( 67 ) == true,  "doubly linked: remove() from middle" );
+    CHECK( dlist.remove( 23 ) == true,  "doubly linked: remove() head" );
+    CHECK( dlist.remove( 166 ) == true, "doubly linked: remove() tail" );
+    CHECK( dlist.used() == LIST2_INI - 6, "doubly linked: used() after remove()" );
+    CHECK( dlist.dequeue(&i) == true, "doubly linked: dequeue() after remove() of tail" );
+    CHECK( i == 155,       "doubly linked: dequeue() yielded correct value" );
+
+    it = dlist.begin();
+    CHECK( *it == 34,      "doubly linked: begin() after remove() of head" );
+    it += 3;
+    CHECK( *it == 78,      "doubly linked: iteration over removed item" );
+
+    /* Drain from both ends alternately, checking for symmetry */
+    CHECK( dlist.push( 11 ),  "doubly linked: push()" );
+    CHECK( dlist.queue( 99 ), "doubly linked: queue()" );
+    CHECK( dlist.dequeue(&i) == true && i == 99, "doubly linked: dequeue() of queue()d item" );
+    CHECK( dlist.dequeue(&i) == true && i == 144, "doubly linked: dequeue() of original item" );
+    CHECK( dlist.pop(&i) == true && i == 11, "doubly linked: pop() of push()ed item" );
+    while( dlist.dequeue(&i) ) {
+    }
+    CHECK( i == 34,        "doubly linked: final dequeue() yielded head item" );
+    CHECK( dlist.used() == 0, "doubly linked: used() after draining" );
+    CHECK( dlist.begin() == dlist.end(), "doubly linked: begin() == end() on empty list" );
+    CHECK( dlist.queue( 1 ), "doubly linked: queue() on drained list" );
+    CHECK( dlist.dequeue(&i) == true && i == 1, "doubly linked: dequeue() sole item" );
+    CHECK( dlist.available() == LIST_LEN, "doubly linked: available() on drained list" );
+}
+
+static void check_compact_links( void )
+{
+    FixedLengthList<int,  LIST_LEN, FixedLengthListCompactSingleLinks > slist( init_list, LIST2_INI );
+    FixedLengthList<int,  LIST_LEN, FixedLengthListCompactDoubleLinks > dlist( init_list, LIST2_INI );
+    FixedLengthList<int,  LIST_LEN, FixedLengthListCompactSingleLinks >::iterator it;
+    int i = 0;
+
+    CHECK( sizeof( FixedLengthListIndex< 255 >::type ) == 1,   "compact links: index type for 255 items" );
+    CHECK( sizeof( FixedLengthListIndex< 256 >::type ) == 2,   "compact links: index type for 256 items" );
+    CHECK( sizeof( FixedLengthListIndex< 65535 >::type ) == 2, "compact links: index type for 65535 items" );
+    CHECK( sizeof( FixedLengthListIndex< 65536 >::type ) == 4, "compact links: index type for 65536 items" );
+    CHECK( sizeof( slist ) < sizeof( list ),  "compact links: smaller than pointer links" );
+
+    CHECK( slist.used() == LIST2_INI, "compact links: used() after initialising constructor" );
+    CHECK( slist.pop(&i) == true && i == 12,      "compact links: pop()" );
+    CHECK( slist.dequeue(&i) == true && i == 188, "compact links: dequeue()" );
+    CHECK( slist.remove( 100 ) == true,  "compact links: remove()" );
+    CHECK( slist.inList( 100 ) == false, "compact links: inList() for removed item" );
+    CHECK( slist.inList( 111 ) == true,  "compact links: inList() for item in list" );
+    CHECK( slist.push( 1 ) && slist.queue( 2 ), "compact links: push() & queue()" );
+    it = slist.begin();
+    CHECK( *it == 1,       "compact links: begin()" );
+    it += 8;
+    CHECK( *it == 111,     "compact links: iteration over removed item" );
+
+    /* Links are relative to the list, so a copy must be independent of the
+       original */
+    {
+        FixedLengthList<int,  LIST_LEN, FixedLengthListCompactSingleLinks > copy( slist );
+        CHECK( copy.pop(&i) == true && i == 1, "compact links: pop() from copy" );
+        CHECK( slist.used() == LIST2_INI - 1, "compact links: original unaffected by copy" );
+        CHECK( *(slist.begin()) == 1, "compact links: original head unaffected by copy" );
+    }
+
+    CHECK( dlist.dequeue(&i) == true && i == 188, "compact double links: dequeue()" );
+    CHECK( dlist.remove( 12 ) == true,  "compact double links: remove() head" );
+    CHECK( dlist.remove( 177 ) == true, "compact double links: remove() tail" );
+    CHECK( dlist.dequeue(&i) == true && i == 166, "compact double links: dequeue() after remove()" );
+    while( dlist.dequeue(&i) ) {
+    }
+    CHECK( i == 23,        "compact double links: final dequeue() yielded head item" );
+    CHECK( dlist.available() == LIST_LEN, "compact double links: available() on drained list" );
+    dlist.clear();
+    CHECK( dlist.queue( 5 ) && dlist.dequeue(&i) && i == 5, "compact double links: queue() and dequeue() after clear()" );
+}
+
+/* Item type with no default constructor which counts its constructions and
+   destructions */
+class Tracked
+{
+    public:
+        static int s_live;
+        static int s_copies;
+        static int s_moves;
+
+        int m_val;
+
+        explicit Tracked( int p_val ) : m_val( p_val ) { s_live++; }
+        Tracked( int p_a, int p_b ) : m_val( p_a + p_b ) { s_live++; }
+        Tracked( const Tracked& p_other ) : m_val( p_other.m_val ) { s_live++; s_copies++; }
+        Tracked& operator=( const Tracked& p_other ) { m_val = p_other.m_val; s_copies++; return *this; }
+#if FIXEDLENGTHLIST_CXX11
+        Tracked( Tracked&& p_other ) : m_val( p_other.m_val ) { p_other.m_val = -1; s_live++; s_moves++; }
+        Tracked& operator=( Tracked&& p_other ) { m_val = p_other.m_val; p_other.m_val = -1; s_moves++; return *this; }
+#endif
+        ~Tracked() { s_live--; }
+
+        bool operator==( const Tracked& p_other ) const { return m_val == p_other.m_val; }
+};
+
+int Tracked::s_live = 0;
+int Tracked::s_copies = 0;
+int Tracked::s_moves = 0;
+
+static void check_object_lifetime( void )
+{
+    Tracked out( 0 );
+    {
+        FixedLengthList<Tracked, 4U > tlist;
+        CHECK( Tracked::s_live == 1, "lifetime: no items constructed by list" );
+
+        Tracked t( 1 );
+        CHECK( tlist.queue( t ) && Tracked::s_live == 3 && Tracked::s_copies == 1, "lifetime: queue() copy constructs item" );
+        tlist.push( Tracked( 2 ) );
+        CHECK( tlist.used() == 2 && Tracked::s_live == 4, "lifetime: push() constructs item" );
+        CHECK( tlist.inList( t ) && tlist.remove( t ) && Tracked::s_live == 3, "lifetime: remove() destroys item" );
+        CHECK( tlist.pop( &out ) && out.m_val == 2 && Tracked::s_live == 2, "lifetime: pop() destroys item" );
+
+        tlist.queue( t );
+        tlist.queue( t );
+        CHECK( Tracked::s_live == 4, "lifetime: queue() items" );
+        tlist.clear();
+        CHECK( Tracked::s_live == 2 && tlist.used() == 0, "lifetime: clear() destroys items" );
+
+        tlist.queue( t );
+        tlist.queue( Tracked( 7 ) );
+        {
+            FixedLengthList<Tracked, 4U > copy( tlist );
+            CHECK( Tracked::s_live == 6 && copy.used() == 2, "lifetime: copy constructor copies items" );
+            CHECK( copy.dequeue( &out ) && out.m_val == 7, "lifetime: copy constructor preserves order" );
+            copy = tlist;
+            CHECK( Tracked::s_live == 6 && copy.used() == 2, "lifetime: assignment replaces items" );
+        }
+        CHECK( Tracked::s_live == 4, "lifetime: destroying copy destroys its items" );
+        CHECK( tlist.used() == 2 && (*tlist.begin()).m_val == 1, "lifetime: original unaffected by copy" );
+    }
+    CHECK( Tracked::s_live == 1, "lifetime: destroying list destroys items" );
+
+#if FIXEDLENGTHLIST_CXX11
+    {
+        FixedLengthList<Tracked, 2U, FixedLengthListCompactDoubleLinks > mlist;
+        Tracked t( 3 );
+        int copies = Tracked::s_copies;
+
+        CHECK( mlist.queue( std::move( t ) ) && t.m_val == -1, "move: queue() moves item" );
+        CHECK( mlist.emplace_front( 4, 5 ) && (*mlist.begin()).m_val == 9, "move: emplace_front() constructs in place" );
+        CHECK( !mlist.emplace_back( 6 ), "move: emplace_back() on full list" );
+        CHECK( Tracked::s_live == 4, "move: failed emplace_back() constructs nothing" );
+
+        FixedLengthList<Tracked, 2U, FixedLengthListCompactDoubleLinks > mlist2( std::move( mlist ) );
+        CHECK( mlist.used() == 0 && mlist2.used() == 2, "move: move constructor empties source" );
+        CHECK( Tracked::s_live == 4, "move: move constructor destroys source items" );
+        CHECK( mlist2.dequeue( &out ) && out.m_val == 3, "move: dequeue() after move" );
+        CHECK( Tracked::s_copies == copies, "move: no items copied" );
+        CHECK( mlist2.emplace_back( 8 ) && mlist2.pop( &out ) && out.m_val == 9, "move: emplace_back() then pop()" );
+    }
+    CHECK( Tracked::s_live == 1, "move: all items destroyed" );
+#endif
+}
+
+template < template < class, size_t > class Links > static void check_batch_links( const char* p_name )
+{
+    int in[ 6 ] = { 1, 2, 3, 4, 5, 6 };
+    int out[ 8 ] = { 0 };
+    FixedLengthList<int, 8U, Links > blist;
+    FixedLengthList<int, 8U, Links > blist2;
+    int i;
+
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.queue_n( in, 3U ) == 3U && blist.used() == 3U, "queue_n()" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.push_n( &in[ 3 ], 3U ) == 3U, "push_n()" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.push_n( in, 6U ) == 2U && blist.available() == 0U, "push_n() on nearly full list" );
+
+    /* List is now 1 2 4 5 6 1 2 3 */
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.pop_n( out, 3U ) == 3U && out[ 0 ] == 1 && out[ 1 ] == 2 && out[ 2 ] == 4, "pop_n()" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.dequeue_n( out, 2U ) == 2U && out[ 0 ] == 3 && out[ 1 ] == 2, "dequeue_n()" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.used() == 3U && blist.pop( &i ) && i == 5 && blist.dequeue( &i ) && i == 1, "pop() & dequeue() after batch" );
+
+    blist.queue_n( in, 6U );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.dequeue_n( out, 8U ) == 7U && out[ 0 ] == 6 && out[ 6 ] == 6 && blist.used() == 0U, "dequeue_n() whole list" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.pop_n( out, 8U ) == 0U && blist.dequeue_n( out, 8U ) == 0U, "pop_n() & dequeue_n() on empty list" );
+
+    blist.queue_n( in, 6U );
+    blist2.queue_n( in, 4U );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist2.splice_back( blist, 2U ) == 2U && blist2.used() == 6U && blist.used() == 4U, "splice_back() run" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist2.splice_back( blist ) == 2U && blist.used() == 2U && blist2.available() == 0U, "splice_back() onto full list" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist2.pop_n( out, 8U ) == 8U && out[ 3 ] == 4 && out[ 4 ] == 1 && out[ 5 ] == 2 && out[ 6 ] == 3 && out[ 7 ] == 4, "splice_back() order" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist.pop( &i ) && i == 5 && blist.queue( 9 ) && blist.used() == 2U, "source list after splice_back()" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist2.splice_back( blist ) == 2U && blist.used() == 0U && blist2.dequeue( &i ) && i == 9, "splice_back() whole list" );
+    PRINTF( "%s: ", p_name );
+    CHECK( blist2.splice_back( blist2 ) == 0U && blist2.used() == 1U, "splice_back() onto self" );
+}
+
+static void check_batch( void )
+{
+    check_batch_links< FixedLengthListSingleLinks >( "batch" );
+    check_batch_links< FixedLengthListDoubleLinks >( "batch double links" );
+    check_batch_links< FixedLengthListCompactSingleLinks >( "batch compact links" );
+
+    Tracked t[ 2 ] = { Tracked( 1 ), Tracked( 2 ) };
+    Tracked out[ 2 ] = { Tracked( 0 ), Tracked( 0 ) };
+    {
+        FixedLengthList<Tracked, 4U > tlist;
+        FixedLengthList<Tracked, 4U > tlist2;
+        int live = Tracked::s_live;
+        tlist.queue_n( t, 2U );
+        tlist.push_n( t, 2U );
+        CHECK( Tracked::s_live == live + 4, "batch: items constructed" );
+        CHECK( tlist2.splice_back( tlist, 3U ) == 3U && Tracked::s_live == live + 4, "batch: splice_back() moves items" );
+        CHECK( tlist.dequeue_n( out, 2U ) == 1U && out[ 0 ].m_val == 2 && Tracked::s_live == live + 3, "batch: dequeue_n() destroys items" );
+        CHECK( tlist2.pop_n( out, 2U ) == 2U && Tracked::s_live == live + 1, "batch: pop_n() destroys items" );
+    }
+}
+
+static void check_lazy_init( void )
+{
+    FixedLengthList<int, 5U > llist;
+    int in[ 4 ] = { 1, 2, 3, 4 };
+    int out[ 5 ] = { 0 };
+    int i;
+
+    /* Mix items recycled via the free stack with those taken from above the
+       high water mark */
+    llist.queue( 10 );
+    llist.queue( 11 );
+    llist.pop( &i );
+    CHECK( llist.queue_n( in, 4U ) == 4U && llist.available() == 0U, "lazy init: queue_n() across high water mark" );
+    CHECK( llist.queue( 12 ) == false, "lazy init: queue() on full list" );
+    CHECK( llist.pop_n( out, 5U ) == 5U && out[ 0 ] == 11 && out[ 1 ] == 1 && out[ 4 ] == 4, "lazy init: items in order" );
+
+    for( unsigned r = 0; r < 3U; r++ )
+    {
+        llist.push( 20 );
+        llist.clear();
+    }
+    CHECK( llist.used() == 0U && llist.available() == 5U, "lazy init: available() after clear()" );
+    CHECK( llist.push_n( in, 4U ) == 4U && llist.push( 5 ) && !llist.push( 6 ), "lazy init: fill after clear()" );
+    CHECK( llist.dequeue( &i ) && i == 4 && llist.pop( &i ) && i == 5, "lazy init: items in order after clear()" );
+
+    FixedLengthList<int, LIST_LEN > ilist( init_list, 2U );
+    CHECK( ilist.available() == LIST_LEN - 2U, "lazy init: initialising constructor available()" );
+    for( i = 0; ilist.queue( i ); i++ ) {
+    }
+    CHECK( i == (int)( LIST_LEN - 2U ) && ilist.pop( &i ) && i == init_list[ 0 ], "lazy init: initialising constructor leaves remaining slots free" );
+}
+
+struct IntHash
+{
+    size_t operator()( const int p_val ) const { return (size_t)p_val * 2654435761U; }
+};
+
+/* Poor hash, forcing long probe sequences */
+struct CollidingHash
+{
+    size_t operator()( const int p_val ) const { return (size_t)( p_val & 3 ); }
+};
+
+/* Counts the empty strings it's asked to hash.  None of the items are
+   empty, so any such is an item which has already been moved from, which
+   would start the index's probe in the wrong bucket */
+struct StringHash
+{
+    static unsigned s_emptyHashed;
+    size_t operator()( const std::string& p_val ) const {
+        size_t ret_val = 5381U;
+        if( p_val.empty() ) {
+            s_emptyHashed++;
+        }
+        for( size_t i = 0; i < p_val.size(); i++ ) {
+            ret_val = ( ret_val * 33U ) ^ (unsigned char)p_val[ i ];
+        }
+        return ret_val;
+    }
+};
+unsigned StringHash::s_emptyHashed = 0U;
+
+typedef FixedLengthList<std::string, LIST_LEN, FixedLengthListDoubleLinks, FixedLengthListHashIndex< StringHash > > string_list_t;
+
+/* Long enough that moving one leaves it empty, rather than copying it in
+   place */
+static std::string long_string( const int p_val )
+{
+    char buf[ 48 ];
+    sprintf( buf, "item %d, long enough not to be held in place", p_val );
+    return std::string( buf );
+}
+
+template < template < class, size_t > class Links, class Index > static bool index_matches_list( void )
+{
+    FixedLengthList<int, 64U, Links, Index > hlist;
+    FixedLengthList<int, 64U, Links > plist;
+    unsigned seed = 1U;
+    bool ok = true;
+    int out[ 8 ];
+
+    /* Apply the same pseudo-random sequence of operations to an indexed and
+       an unindexed list, checking that lookups agree */
+    for( unsigned n = 0; n < 4000U; n++ )
+    {
+        int i, j;
+        seed = seed * 1103515245U + 12345U;
+        int v = (int)( ( seed >> 16 ) % 100U );
+
+        switch( ( seed >> 8 ) % 8U )
+        {
+            case 0: hlist.push( v ); plist.push( v ); break;
+            case 1: hlist.queue( v ); plist.queue( v ); break;
+            case 2: ok = ok && ( hlist.pop( &i ) == plist.pop( &j ) ); break;
+            case 3: ok = ok && ( hlist.dequeue( &i ) == plist.dequeue( &j ) ); break;
+            case 4: ok = ok && ( hlist.remove( v ) == plist.remove( v ) ); break;
+            case 5: ok = ok && ( hlist.pop_n( out, 3U ) == plist.pop_n( out, 3U ) ); break;
+            case 6: hlist.queue_n( &v, 1U ); plist.queue_n( &v, 1U ); break;
+            default: if( v == 0 ) { hlist.clear(); plist.clear(); } break;
+        }
+
+        ok = ok && ( hlist.used() == plist.used() );
+        for( int k = 0; k < 100; k += 7 )
+        {
+            ok = ok && ( hlist.inList( k ) == plist.inList( k ) );
+        }
+    }
+
+    return ok;
+}
+
+static void check_hash_index( void )
+{
+    FixedLengthList<int, LIST_LEN, FixedLengthListCompactDoubleLinks, FixedLengthListHashIndex< IntHash > > hlist( init_list, LIST2_INI );
+    int i;
+
+    CHECK( hlist.inList( 12 ) && hlist.inList( 188 ) && !hlist.inList( 13 ), "hash index: inList() after initialising constructor" );
+    CHECK( hlist.remove( 100 ) && !hlist.inList( 100 ) && hlist.used() == LIST2_INI - 1U, "hash index: remove()" );
+    CHECK( !hlist.remove( 100 ), "hash index: remove() item not in list" );
+    CHECK( hlist.pop( &i ) && i == 12 && !hlist.inList( 12 ), "hash index: pop()" );
+    CHECK( hlist.dequeue( &i ) && i == 188 && !hlist.inList( 188 ), "hash index: dequeue()" );
+    CHECK( hlist.push( 7 ) && hlist.queue( 7 ) && hlist.remove( 7 ) && hlist.inList( 7 ), "hash index: duplicate items" );
+    hlist.clear();
+    CHECK( !hlist.inList( 7 ) && !hlist.inList( 23 ) && hlist.queue( 23 ) && hlist.inList( 23 ), "hash index: clear()" );
+
+    CHECK( ( index_matches_list< FixedLengthListDoubleLinks, FixedLengthListHashIndex< IntHash > >() ), "hash index: agrees with unindexed list" );
+    CHECK( ( index_matches_list< FixedLengthListSingleLinks, FixedLengthListHashIndex< CollidingHash > >() ), "hash index: agrees with unindexed list with colliding hash" );
+
+    check_hash_index_strings();
+}
+
+static void check_hash_index_strings( void )
+{
+    string_list_t slist;
+    string_list_t other;
+    std::string s;
+    std::string items[ 4 ];
+    bool ok = true;
+
+    for( int n = 0; n < (int)LIST_LEN; n++ ) {
+        slist.queue( long_string( n ) );
+    }
+    StringHash::s_emptyHashed = 0U;
+
+    CHECK( slist.pop( &s ) && s == long_string( 0 ) && !slist.inList( s ), "hash index, strings: pop()" );
+    CHECK( slist.dequeue( &s ) && s == long_string( LIST_LEN - 1 ) && !slist.inList( s ), "hash index, strings: dequeue()" );
+    CHECK( slist.pop_n( items, 2U ) == 2U && items[ 1 ] == long_string( 2 ) && !slist.inList( items[ 0 ] ) && !slist.inList( items[ 1 ] ), "hash index, strings: pop_n()" );
+    CHECK( slist.dequeue_n( items, 2U ) == 2U && items[ 0 ] == long_string( LIST_LEN - 2 ) && !slist.inList( items[ 0 ] ) && !slist.inList( items[ 1 ] ), "hash index, strings: dequeue_n()" );
+    CHECK( other.splice_back( slist, 3U ) == 3U && other.inList( long_string( 5 ) ) && !slist.inList( long_string( 5 ) ), "hash index, strings: splice_back()" );
+#if FIXEDLENGTHLIST_CXX11
+    {
+        string_list_t moved( std::move( slist ) );
+        ok = moved.inList( long_string( 6 ) ) && !slist.inList( long_string( 6 ) );
+        slist = std::move( moved );
+        ok = ok && slist.inList( long_string( 6 ) ) && !moved.inList( long_string( 6 ) );
+    }
+#endif
+    CHECK( ok && StringHash::s_emptyHashed == 0U, "hash index, strings: items not hashed once moved from" );
+
+    ok = ( slist.used() == LIST_LEN - 9U );
+    for( int n = 6; n < (int)LIST_LEN - 3; n++ ) {
+        ok = ok && slist.remove( long_string( n ) );
+    }
+    CHECK( ok && slist.used() == 0U, "hash index, strings: remaining items found" );
+}
+
+template < class T > static bool scan_index_finds_each( void )
+{
+    /* Odd length, so that the end of the pool doesn't fill a vector */
+    FixedLengthList<T, 77U, FixedLengthListCompactDoubleLinks, FixedLengthListScanIndex > slist;
+    bool ok = true;
+
+    for( int i = 0; i < 77; i++ )
+    {
+        slist.queue( (T)( i * 3 ) );
+    }
+
+    for( int i = 0; i < 77; i++ )
+    {
+        ok = ok && slist.inList( (T)( i * 3 ) ) && !slist.inList( (T)( i * 3 + 1 ) );
+    }
+
+    /* Removed items must not be found, even though their slot still holds
+       the value */
+    for( int i = 0; i < 77; i += 2 )
+    {
+        ok = ok && slist.remove( (T)( i * 3 ) );
+    }
+    for( int i = 0; i < 77; i++ )
+    {
+        ok = ok && ( slist.inList( (T)( i * 3 ) ) == ( ( i % 2 ) != 0 ) );
+    }
+
+    return ok;
+}
+
+static void check_scan_index( void )
+{
+    FixedLengthList<int, LIST_LEN, FixedLengthListCompactDoubleLinks, FixedLengthListScanIndex > slist( init_list, LIST2_INI );
+    FixedLengthList<int, LIST_LEN, FixedLengthListSingleLinks, FixedLengthListScanIndex > plist( init_list, LIST2_INI );
+    int i;
+
+    CHECK( slist.inList( 12 ) && slist.inList( 188 ) && !slist.inList( 13 ), "scan index: inList()" );
+    CHECK( slist.remove( 100 ) && !slist.inList( 100 ) && slist.used() == LIST2_INI - 1U, "scan index: remove()" );
+    CHECK( slist.dequeue( &i ) && i == 188 && !slist.inList( 188 ) && slist.inList( 177 ), "scan index: dequeue()" );
+    slist.clear();
+    CHECK( !slist.inList( 12 ) && slist.queue( 12 ) && slist.inList( 12 ), "scan index: clear()" );
+    CHECK( plist.remove( 12 ) && !plist.inList( 12 ) && plist.inList( 23 ), "scan index: pointer links" );
+
+    CHECK( scan_index_finds_each< char >(), "scan index: char items" );
+    CHECK( scan_index_finds_each< short >(), "scan index: short items" );
+    CHECK( scan_index_finds_each< unsigned >(), "scan index: unsigned items" );
+    CHECK( scan_index_finds_each< long long >(), "scan index: long long items" );
+    CHECK( scan_index_finds_each< double >(), "scan index: double items" );
+
+    /* The scan shortens again once the highest items are gone */
+    {
+        typedef FixedLengthListCompactDoubleLinks< int, 100U > links_t;
+        static links_t links;
+        FixedLengthListScanIndex::table< links_t, 100U > table;
+
+        for( size_t k = 0; k < 100U; k++ )
+        {
+            table.index_insert( links, links.slot( k ) );
+        }
+        CHECK( table.limit() == 100U, "scan index: scan covers slots in use" );
+        table.index_erase( links, links.slot( 99U ) );
+        table.index_erase( links, links.slot( 50U ) );
+        CHECK( table.limit() == 100U, "scan index: limit kept while top word in use" );
+        for( size_t k = 64U; k < 99U; k++ )
+        {
+            table.index_erase( links, links.slot( k ) );
+        }
+        CHECK( table.limit() == 64U, "scan index: limit lowered as top words empty" );
+        for( size_t k = 0U; k < 64U; k++ )
+        {
+            table.index_erase( links, links.slot( k ) );
+        }
+        table.index_insert( links, links.slot( 0U ) );
+        CHECK( table.limit() == 1U, "scan index: limit lowered once empty" );
+    }
+    {
+        FixedLengthList<int, 100U, FixedLengthListCompactDoubleLinks, FixedLengthListScanIndex > clist;
+        for( int k = 0; k < 100; k++ )
+        {
+            clist.queue( k );
+        }
+        clist.clear();
+        clist.queue( 7 );
+        CHECK( clist.inList( 7 ) && !clist.inList( 99 ) && clist.used() == 1U, "scan index: clear() then queue()" );
+    }
+
+    CHECK( ( index_matches_list< FixedLengthListCompactSingleLinks, FixedLengthListScanIndex >() ), "scan index: agrees with unindexed list" );
+    CHECK( ( index_matches_list< FixedLengthListDoubleLinks, FixedLengthListScanIndex >() ), "scan index: agrees with unindexed list with pointer links" );
+}
+
+static void check_stats( void )
+{
+    typedef FixedLengthListStatsSnapshot snap_t;
+    FixedLengthList<int, 4U, FixedLengthListSingleLinks, FixedLengthListNoIndex, FixedLengthListStats > list;
+    FixedLengthList<int, 4U, FixedLengthListSingleLinks, FixedLengthListNoIndex, FixedLengthListStats > other;
+    FixedLengthList<int, 4U > plain;
+    int items[] = { 1, 2, 3 };
+    int i;
+
+    CHECK( sizeof( plain ) == sizeof( FixedLengthList<int, 4U, FixedLengthListSingleLinks, FixedLengthListNoIndex, FixedLengthListNoStats > ), "stats: no cost when disabled" );
+    CHECK( plain.stats().m_peakUsed == 0 && plain.queue( 1 ) && plain.stats().m_ops[ snap_t::OP_QUEUE ] == 0, "stats: nothing recorded when disabled" );
+
+    list.queue( 10 );
+    list.push( 20 );
+    list.queue_n( items, 3 );
+    snap_t s = list.stats();
+    CHECK( s.m_peakUsed == 4 && s.m_rejected == 1, "stats: peak used() & rejected inserts" );
+    CHECK( s.m_ops[ snap_t::OP_QUEUE ] == 2 && s.m_ops[ snap_t::OP_PUSH ] == 1, "stats: insert operation counts" );
+    CHECK( list.queue( 99 ) == false && list.stats().m_rejected == 2, "stats: rejected queue()" );
+
+    /* List is 20, 10, 1, 2 */
+    list.inList( 20 );
+    list.inList( 2 );
+    list.inList( 77 );
+    s = list.stats();
+    CHECK( s.m_ops[ snap_t::OP_SEARCH ] == 3 && s.m_scans[ 1 ] == 1 && s.m_scans[ 3 ] == 2, "stats: inList() search lengths" );
+    CHECK( list.remove( 10 ) && list.stats().m_scans[ 2 ] == 1 && list.stats().m_ops[ snap_t::OP_REMOVE ] == 1, "stats: remove() search length" );
+
+    /* Singly linked dequeue() walks to the new tail, 20, 1 */
+    CHECK( list.dequeue( &i ) && list.stats().m_scans[ 2 ] == 2 && list.stats().m_ops[ snap_t::OP_DEQUEUE ] == 1, "stats: dequeue() walk length" );
+    list.pop( &i );
+    CHECK( list.stats().m_ops[ snap_t::OP_POP ] == 1, "stats: pop() counted" );
+
+    other.queue( 5 );
+    list.splice_back( other );
+    list.clear();
+    s = list.stats();
+    CHECK( s.m_ops[ snap_t::OP_SPLICE ] == 1 && s.m_ops[ snap_t::OP_CLEAR ] == 1 && s.m_peakUsed == 4, "stats: splice_back() & clear() counted, peak kept" );
+
+    list.reset_stats();
+    s = list.stats();
+    CHECK( s.m_peakUsed == 0 && s.m_rejected == 0 && s.m_ops[ snap_t::OP_QUEUE ] == 0 && s.m_scans[ 3 ] == 0, "stats: reset_stats()" );
+
+    CHECK( snap_t::scan_bucket( 0 ) == 0 && snap_t::scan_bucket( 1 ) == 1 && snap_t::scan_bucket( 7 ) == 3 && snap_t::scan_bucket( 8 ) == 4 &&
+           snap_t::scan_bucket( (size_t)-1 ) == snap_t::SCAN_BUCKETS - 1U, "stats: scan_bucket()" );
+}
+
+static bool is_odd( const int p_val )
+{
+    return ( p_val & 1 ) != 0;
+}
+
+/* Compare a list's contents, front to back, with an array, using a
+   const_iterator */
+template < class List > static bool contents_are( const List& p_list, const int* const p_vals, const size_t p_count )
+{
+    bool ret_val = ( p_list.used() == p_count );
+    size_t i = 0;
+
+    for( typename List::const_iterator it = p_list.cbegin();
+         ret_val && ( it != p_list.cend() );
+         ++it, i++ )
+    {
+        ret_val = ( i < p_count ) && ( *it == p_vals[ i ] );
+    }
+
+    return ret_val && ( i == p_count );
+}
+
+template < template < class, size_t > class Links, class Index > static void check_erase_insert_links( const char* p_name )
+{
+    typedef FixedLengthList< int, LIST_LEN, Links, Index, FixedLengthListStats > list_t;
+    typedef FixedLengthListStatsSnapshot snap_t;
+
+    list_t elist;
+    int n = 0;
+    const int vals[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    const int evens[] = { 2, 4, 6, 8, 10 };
+    const int inserted[] = { 0, 2, 3, 4, 6, 8, 10, 11 };
+
+    PRINTF( "erase() & insert_after() - %s\n", p_name );
+
+    elist.queue_n( vals, 10U );
+    elist.reset_stats();
+
+    /* Filter in place, without any walk of the list */
+    for( typename list_t::iterator it = elist.begin(); it != elist.end(); )
+    {
+        if( is_odd( *it ) ) {
+            it = elist.erase( it );
+        } else {
+            ++it;
+        }
+    }
+    CHECK( contents_are( elist, evens, 5U ), "erase(): filter in place" );
+    snap_t s = elist.stats();
+    size_t scans = 0U;
+    for( size_t b = 0; b < snap_t::SCAN_BUCKETS; b++ )
+    {
+        scans += s.m_scans[ b ];
+    }
+    CHECK( s.m_ops[ snap_t::OP_ERASE ] == 5 && scans == 0, "erase(): no walk of list" );
+    CHECK( !elist.inList( 1 ) && !elist.inList( 9 ) && elist.inList( 2 ) && elist.inList( 10 ), "erase(): index updated" );
+
+    /* insert_after() the head, the tail and end(), then at the front by
+       way of push() */
+    typename list_t::iterator it = elist.begin();
+    CHECK( *elist.insert_after( it, 3 ) == 3, "insert_after(): yields new item" );
+    it = std::find( elist.begin(), elist.end(), 10 );
+    CHECK( it != elist.end() && *it == 10, "std::find()" );
+    it = elist.insert_after( it, 11 );
+    CHECK( *it == 11 && ++it == elist.end(), "insert_after(): tail" );
+    elist.push( 0 );
+    CHECK( contents_are( elist, inserted, 8U ) && elist.inList( 3 ) && elist.inList( 11 ), "insert_after(): contents & index" );
+    CHECK( std::count_if( elist.cbegin(), elist.cend(), is_odd ) == 2, "std::count_if() on const_iterator" );
+
+    /* Erase the tail, then queue to check that the tail was updated */
+    it = std::find( elist.begin(), elist.end(), 11 );
+    CHECK( elist.erase( it ) == elist.end() && elist.queue( 12 ), "erase(): tail" );
+    it = elist.begin();
+    it = elist.erase( it );
+    CHECK( *it == 2 && elist.push( 1 ) && *elist.begin() == 1, "erase(): head" );
+
+    /* An iterator which wasn't reached from begin() still works */
+    typename list_t::iterator mid = std::find( elist.begin(), elist.end(), 6 );
+    elist.erase( std::find( elist.begin(), elist.end(), 4 ) );
+    CHECK( *elist.erase( mid ) == 8 && !elist.inList( 6 ) && elist.used() == 6, "erase(): after erase of preceding item" );
+
+    it = elist.insert_after( elist.end(), 13 );
+    CHECK( *it == 13 && elist.dequeue( &n ) && n == 13 && !elist.inList( 13 ), "insert_after(): end() queues" );
+    while( elist.queue( 0 ) ) {
+    }
+    CHECK( elist.insert_after( elist.begin(), 1 ) == elist.end() && elist.stats().m_rejected == 2, "insert_after(): full list" );
+
+    elist.clear();
+    CHECK( elist.insert_after( elist.end(), 7 ) != elist.end() && elist.used() == 1 && elist.inList( 7 ), "insert_after(): empty list" );
+    CHECK( elist.erase( elist.begin() ) == elist.end() && elist.used() == 0 && elist.begin() == elist.end(), "erase(): sole item" );
+}
+
+static void check_erase_insert( void )
+{
+    typedef FixedLengthList< int, LIST_LEN, FixedLengthListDoubleLinks > dlist_t;
+
+    check_erase_insert_links< FixedLengthListSingleLinks, FixedLengthListNoIndex >( "single" );
+    check_erase_insert_links< FixedLengthListDoubleLinks, FixedLengthListNoIndex >( "double" );
+    check_erase_insert_links< FixedLengthListCompactSingleLinks, FixedLengthListHashIndex< IntHash > >( "compact single, hash index" );
+    check_erase_insert_links< FixedLengthListCompactDoubleLinks, FixedLengthListHashIndex< IntHash > >( "compact double, hash index" );
+
+    PRINTF( "Bidirectional & const iterators\n" );
+
+    dlist_t dlist( init_list, LIST2_INI );
+    const dlist_t& clist = dlist;
+    dlist_t::iterator it = dlist.end();
+
+    CHECK( *( --it ) == 188 && *( --it ) == 177 && *( it-- ) == 177 && *it == 166, "iterators: operator-- (including from end())" );
+    CHECK( *( ++it ) == 177, "iterators: operator++ after operator--" );
+    dlist_t::const_iterator cit = it;
+    CHECK( *cit == 177 && clist.begin() == dlist.cbegin() && clist.end() == dlist.cend(), "iterators: const_iterator from iterator" );
+    it = dlist.erase( it );
+    CHECK( *it == 188 && *( --it ) == 166, "iterators: operator-- after erase()" );
+
+    int n = 0;
+    for( dlist_t::const_iterator c = clist.begin(); c != clist.end(); ++c )
+    {
+        n++;
+    }
+    CHECK( n == (int)( LIST2_INI - 1U ) && std::distance( clist.begin(), clist.end() ) == n, "iterators: const iteration" );
+
+    std::reverse_iterator< dlist_t::iterator > rit( dlist.end() );
+    CHECK( *rit == 188 && *( ++rit ) == 166, "iterators: std::reverse_iterator" );
+}
+
+/* Churn a list with a pseudo-random sequence of operations, then check that
+   compact() keeps its contents and order while laying the items out in
+   list order */
+template < template < class, size_t > class Links, class Index > static bool compact_keeps_list( void )
+{
+    typedef FixedLengthList< int, 64U, Links, Index > list_t;
+
+    list_t clist;
+    unsigned seed = 3U;
+    bool ok = true;
+    int before[ 64 ] = { 0 };
+    size_t count = 0U;
+    int i;
+
+    for( unsigned n = 0; n < 2000U; n++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+        int v = (int)( ( seed >> 16 ) % 100U );
+
+        switch( ( seed >> 8 ) % 5U )
+        {
+            case 0: clist.push( v ); break;
+            case 1: case 2: clist.queue( v ); break;
+            case 3: clist.pop( &i ); break;
+            default: clist.remove( v ); break;
+        }
+    }
+
+    for( typename list_t::const_iterator it = clist.cbegin(); it != clist.cend(); ++it )
+    {
+        before[ count++ ] = *it;
+    }
+
+    clist.compact();
+
+    ok = contents_are( clist, before, count );
+
+    /* Items are now at increasing, evenly spaced addresses */
+    const char* prev = NULL;
+    ptrdiff_t stride = 0;
+    for( typename list_t::iterator it = clist.begin(); it != clist.end(); ++it )
+    {
+        const char* addr = reinterpret_cast< const char* >( &( *it ) );
+        if( prev != NULL )
+        {
+            stride = ( stride == 0 ) ? ( addr - prev ) : stride;
+            ok = ok && ( stride > 0 ) && ( ( addr - prev ) == stride );
+        }
+        prev = addr;
+    }
+
+    for( size_t k = 0; k < count; k++ )
+    {
+        ok = ok && clist.inList( before[ k ] );
+    }
+
+    /* All of the free slots are still available */
+    size_t used = clist.used();
+    while( clist.queue( -1 ) ) {
+    }
+    ok = ok && ( used == count ) && ( clist.used() == 64U ) && clist.inList( -1 );
+    while( clist.pop( &i ) ) {
+    }
+    ok = ok && ( clist.used() == 0U ) && ( clist.compact() == 0U ) && ( clist.begin() == clist.end() );
+
+    return ok;
+}
+
+static void check_compact( void )
+{
+    PRINTF( "compact()\n" );
+
+    FixedLengthList<int, 8U > clist;
+    const int vals[] = { 1, 2, 3, 4, 5 };
+    const int after[] = { 0, 2, 4, 5, 6 };
+    int i;
+
+    clist.queue_n( vals, 5U );
+    CHECK( clist.compact() == 0U, "compact(): items already in place" );
+    clist.remove( 3 );
+    clist.pop( &i );
+    clist.push( 0 );
+    clist.queue( 6 );
+    CHECK( clist.compact() == 3U && contents_are( clist, after, 5U ), "compact(): items moved, order kept" );
+    CHECK( &( *clist.begin() ) < &( *( ++clist.begin() ) ), "compact(): head is first in memory" );
+    CHECK( clist.queue( 7 ) && clist.push( -1 ) && clist.queue( 8 ) && !clist.queue( 9 ) && clist.used() == 8U, "compact(): free slots available" );
+
+    CHECK( ( compact_keeps_list< FixedLengthListSingleLinks, FixedLengthListNoIndex >() ), "compact(): after churn, single links" );
+    CHECK( ( compact_keeps_list< FixedLengthListDoubleLinks, FixedLengthListNoIndex >() ), "compact(): after churn, double links" );
+    CHECK( ( compact_keeps_list< FixedLengthListCompactSingleLinks, FixedLengthListScanIndex >() ), "compact(): after churn, compact single links, scan index" );
+    CHECK( ( compact_keeps_list< FixedLengthListCompactDoubleLinks, FixedLengthListHashIndex< IntHash > >() ), "compact(): after churn, compact double links, hash index" );
+
+    {
+        FixedLengthList<Tracked, 4U, FixedLengthListDoubleLinks > tlist;
+        int live = Tracked::s_live;
+
+        tlist.queue( Tracked( 1 ) );
+        tlist.queue( Tracked( 2 ) );
+        tlist.queue( Tracked( 3 ) );
+        tlist.remove( Tracked( 2 ) );
+        tlist.push( Tracked( 4 ) );
+        CHECK( tlist.compact() == 2U && Tracked::s_live == live + 3, "compact(): items neither leaked nor lost" );
+        CHECK( (*tlist.begin()).m_val == 4 && (*( --tlist.end() )).m_val == 3, "compact(): non-trivial items in order" );
+    }
+}
+
+#if FIXEDLENGTHLIST_CXX14
+/* Check that a list built from const_init_list holds its items and can be
+   used as any other list */
+template < template < class, size_t > class Links, class Index, class Stats >
+static bool static_list_ok( FixedLengthList< int, LIST_LEN, Links, Index, Stats >& p_list )
+{
+    int i = 0;
+    bool ok = ( p_list.used() == LIST2_INI ) && ( p_list.available() == LIST_LEN - LIST2_INI );
+
+    ok = ok && std::equal( p_list.cbegin(), p_list.cend(), const_init_list );
+    ok = ok && p_list.inList( 100 ) && p_list.remove( 100 ) && !p_list.inList( 100 );
+    ok = ok && p_list.dequeue( &i ) && ( i == 188 ) && p_list.pop( &i ) && ( i == 12 );
+
+    /* Fill the list, using the slots above those filled by the constructor */
+    while( p_list.queue( i ) )
+    {
+    }
+    ok = ok && ( p_list.used() == LIST_LEN ) && ( *p_list.cbegin() == 23 );
+
+    return ok;
+}
+#endif
+
+static void check_static_init( void )
+{
+#if FIXEDLENGTHLIST_CXX14
+    CHECK( static_list_ok( static_single ), "static init: single links" );
+    CHECK( static_list_ok( static_double ), "static init: double links" );
+    CHECK( static_list_ok( static_compact_single ), "static init: compact single links" );
+    CHECK( static_list_ok( static_compact_double ), "static init: compact double links" );
+
+    /* Policies without constexpr constructors fall back to run time
+       construction, so must still index and count the items */
+    {
+        FixedLengthList< int, LIST_LEN, FixedLengthListCompactDoubleLinks, FixedLengthListHashIndex< IntHash >, FixedLengthListStats > indexed( const_init_list );
+        CHECK( indexed.stats().m_ops[ FixedLengthListStatsSnapshot::OP_QUEUE ] == 1U && indexed.stats().m_peakUsed == LIST2_INI, "static init: stats recorded" );
+        CHECK( static_list_ok( indexed ), "static init: hash index" );
+    }
+
+    /* As do items with a destructor */
+    {
+        const Tracked items[ 3 ] = { Tracked( 1 ), Tracked( 2 ), Tracked( 3 ) };
+        int live = Tracked::s_live;
+        {
+            FixedLengthList< Tracked, 4U > tlist( items );
+            CHECK( tlist.used() == 3U && Tracked::s_live == live + 3 && (*tlist.begin()).m_val == 1, "static init: items with destructor" );
+        }
+        CHECK( Tracked::s_live == live, "static init: items with destructor destroyed" );
+    }
+#endif
+}
+
+/* Churn a list, take a snapshot of it and restore the snapshot into a second
+   list, checking that the contents and order are kept */
+template < template < class, size_t > class Links, class Index > static bool snapshot_round_trip( const bool p_churn )
+{
+    typedef FixedLengthList< int, 64U, Links, Index > list_t;
+
+    list_t src;
+    list_t dst;
+    unsigned seed = 7U;
+    unsigned char buffer[ sizeof( FixedLengthListSnapshotHeader ) + ( 64U * sizeof( int ) ) ];
+    int before[ 64 ];
+    size_t count = 0U;
+    int i;
+
+    for( unsigned n = 0; n < ( p_churn ? 2000U : 40U ); n++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+        int v = (int)( ( seed >> 16 ) % 100U );
+
+        switch( p_churn ? ( ( seed >> 8 ) % 5U ) : 1U )
+        {
+            case 0: src.push( v ); break;
+            case 1: case 2: src.queue( v ); break;
+            case 3: src.pop( &i ); break;
+            default: src.remove( v ); break;
+        }
+    }
+
+    for( typename list_t::const_iterator it = src.cbegin(); it != src.cend(); ++it )
+    {
+        before[ count++ ] = *it;
+    }
+
+    dst.queue( -1 );
+
+    size_t written = src.snapshot( buffer, sizeof( buffer ) );
+    bool ok = ( written == src.snapshot_size() ) &&
+              ( dst.restore( buffer, sizeof( buffer ) ) == written ) &&
+              contents_are( src, before, count ) &&
+              contents_are( dst, before, count ) &&
+              !dst.inList( -1 );
+
+    for( size_t k = 0; k < count; k++ )
+    {
+        ok = ok && dst.inList( before[ k ] );
+    }
+
+    /* The restored list is fully usable */
+    while( dst.queue( -2 ) ) {
+    }
+    ok = ok && ( dst.used() == 64U ) && dst.remove( -2 ) && dst.inList( -2 );
+
+    return ok;
+}
+
+static void check_snapshot( void )
+{
+    PRINTF( "snapshot() & restore()\n" );
+
+    FixedLengthList<int, 8U > slist;
+    FixedLengthList<int, 8U > rlist;
+    FixedLengthList<int, 4U > small_list;
+    FixedLengthList<short, 8U > short_list;
+    const int vals[] = { 1, 2, 3, 4, 5 };
+    unsigned char buffer[ 64 ];
+    unsigned char bad[ 64 ];
+    FixedLengthListSnapshotHeader header;
+
+    CHECK( slist.snapshot_size() == sizeof( FixedLengthListSnapshotHeader ) && slist.snapshot( buffer, sizeof( buffer ) ) == sizeof( FixedLengthListSnapshotHeader ), "snapshot(): empty list" );
+    rlist.queue( 9 );
+    CHECK( rlist.restore( buffer, sizeof( buffer ) ) == sizeof( FixedLengthListSnapshotHeader ) && rlist.used() == 0U, "restore(): empty list" );
+
+    slist.queue_n( vals, 5U );
+    CHECK( slist.snapshot( buffer, slist.snapshot_size() - 1U ) == 0U, "snapshot(): buffer too small" );
+    CHECK( slist.snapshot( buffer, sizeof( buffer ) ) == slist.snapshot_size(), "snapshot(): written" );
+    memcpy( &header, buffer, sizeof( header ) );
+    CHECK( header.m_magic == FixedLengthListSnapshotHeader::MAGIC && header.m_itemSize == sizeof( int ) && header.m_count == 5U, "snapshot(): header" );
+
+    CHECK( rlist.restore( buffer, sizeof( buffer ) ) == slist.snapshot_size() && contents_are( rlist, vals, 5U ), "restore(): contents" );
+    CHECK( rlist.restore( buffer, slist.snapshot_size() - 1U ) == 0U && rlist.used() == 0U, "restore(): truncated snapshot leaves list empty" );
+    CHECK( small_list.restore( buffer, sizeof( buffer ) ) == 0U && small_list.used() == 0U, "restore(): too many items" );
+    CHECK( short_list.restore( buffer, sizeof( buffer ) ) == 0U, "restore(): wrong item size" );
+
+    memcpy( bad, buffer, sizeof( bad ) );
+    bad[ 0 ] ^= 0xFFU;
+    CHECK( rlist.restore( bad, sizeof( bad ) ) == 0U, "restore(): bad magic" );
+
+    memcpy( bad, buffer, sizeof( bad ) );
+    header.m_version = FixedLengthListSnapshotHeader::VERSION + 1U;
+    memcpy( bad, &header, sizeof( header ) );
+    CHECK( rlist.restore( bad, sizeof( bad ) ) == 0U, "restore(): unknown version" );
+
+    /* A longer header, as a later version might write, is skipped */
+    header.m_version = FixedLengthListSnapshotHeader::VERSION;
+    header.m_headerSize = sizeof( header ) + 4U;
+    memcpy( bad, &header, sizeof( header ) );
+    memset( bad + sizeof( header ), 0xAA, 4U );
+    memcpy( bad + sizeof( header ) + 4U, buffer + sizeof( header ), 5U * sizeof( int ) );
+    CHECK( rlist.restore( bad, sizeof( bad ) ) == slist.snapshot_size() + 4U && contents_are( rlist, vals, 5U ), "restore(): longer header skipped" );
+
+    /* Items part read are dropped from the index as well as the list */
+    {
+        FixedLengthList<int, 8U, FixedLengthListSingleLinks, FixedLengthListHashIndex< IntHash > > hlist;
+        CHECK( hlist.restore( buffer, slist.snapshot_size() - 1U ) == 0U && hlist.used() == 0U && !hlist.inList( 1 ), "restore(): truncated snapshot, hash index" );
+        CHECK( hlist.queue( 1 ) && hlist.inList( 1 ) && hlist.remove( 1 ) && !hlist.inList( 1 ), "restore(): list usable after failure" );
+    }
+
+    CHECK( ( snapshot_round_trip< FixedLengthListSingleLinks, FixedLengthListNoIndex >( false ) ), "snapshot(): queued, single links" );
+    CHECK( ( snapshot_round_trip< FixedLengthListCompactDoubleLinks, FixedLengthListNoIndex >( false ) ), "snapshot(): queued, compact double links" );
+    CHECK( ( snapshot_round_trip< FixedLengthListSingleLinks, FixedLengthListNoIndex >( true ) ), "snapshot(): after churn, single links" );
+    CHECK( ( snapshot_round_trip< FixedLengthListDoubleLinks, FixedLengthListNoIndex >( true ) ), "snapshot(): after churn, double links" );
+    CHECK( ( snapshot_round_trip< FixedLengthListCompactSingleLinks, FixedLengthListScanIndex >( true ) ), "snapshot(): after churn, compact single links, scan index" );
+    CHECK( ( snapshot_round_trip< FixedLengthListCompactDoubleLinks, FixedLengthListHashIndex< IntHash > >( true ) ), "snapshot(): after churn, compact double links, hash index" );
+}
+
+static void check_overwrite( void )
+{
+    PRINTF( "queue_overwrite()\n" );
+
+    FixedLengthList<int, 4U, FixedLengthListDoubleLinks, FixedLengthListHashIndex< IntHash > > olist;
+    const int vals[] = { 1, 2, 3, 4 };
+    const int after[] = { 3, 4, 5, 6 };
+    int i = -1;
+
+    CHECK( !olist.queue_overwrite( 1 ) && !olist.queue_overwrite( 2, &i ) && i == -1, "queue_overwrite(): space available" );
+    olist.queue( 3 );
+    olist.queue( 4 );
+    CHECK( contents_are( olist, vals, 4U ) && !olist.queue( 5 ), "queue_overwrite(): list full" );
+    CHECK( olist.queue_overwrite( 5 ) && olist.queue_overwrite( 6, &i ) && i == 2, "queue_overwrite(): oldest item returned" );
+    CHECK( contents_are( olist, after, 4U ) && olist.used() == 4U, "queue_overwrite(): newest items kept in order" );
+    CHECK( !olist.inList( 1 ) && !olist.inList( 2 ) && olist.inList( 6 ), "queue_overwrite(): index follows" );
+
+    {
+        FixedLengthList<Tracked, 2U > tlist;
+        Tracked evicted( 0 );
+        int live = Tracked::s_live;
+
+        tlist.queue( Tracked( 1 ) );
+        tlist.queue( Tracked( 2 ) );
+        bool overwritten = tlist.queue_overwrite( Tracked( 3 ), &evicted );
+        CHECK( overwritten && evicted.m_val == 1 && Tracked::s_live == live + 2, "queue_overwrite(): items neither leaked nor lost" );
+#if FIXEDLENGTHLIST_CXX11
+        Tracked t( 4 );
+        overwritten = tlist.queue_overwrite( std::move( t ), &evicted );
+        CHECK( overwritten && evicted.m_val == 2 && t.m_val == -1 && (*( ++tlist.begin() )).m_val == 4, "queue_overwrite(): item moved into place" );
+#endif
+    }
+
+    {
+        string_list_t slist;
+        std::string evicted;
+        bool ok = true;
+
+        for( int n = 0; n < (int)LIST_LEN; n++ ) {
+            slist.queue( long_string( n ) );
+        }
+        StringHash::s_emptyHashed = 0U;
+
+        for( int n = (int)LIST_LEN; n < (int)LIST_LEN * 3; n++ ) {
+            ok = ok && slist.queue_overwrite( long_string( n ), &evicted ) && evicted == long_string( n - (int)LIST_LEN );
+            ok = ok && !slist.inList( evicted ) && slist.inList( long_string( n ) );
+        }
+        CHECK( ok && StringHash::s_emptyHashed == 0U, "queue_overwrite(): hash index, strings, evicted item not hashed once moved from" );
+    }
+}
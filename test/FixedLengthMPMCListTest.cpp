@@ -0,0 +1,159 @@
+/**
+   @file
+   @brief Tests for the FixedLengthMPMCList class, including a multi-threaded
+          stress test
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+
+#include "FixedLengthMPMCList.hpp"
+
+#define LIST_LEN (20U)
+#define STRESS_LIST_LEN (64U)
+#define STRESS_THREADS (4U)
+#define STRESS_ITEMS (200000U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+/* Item larger than a single word, to check that it is copied in and out
+   intact */
+struct Record
+{
+    uint32_t producer;
+    uint32_t seq;
+    uint32_t check;
+};
+
+FixedLengthMPMCList<int,  LIST_LEN > list;
+FixedLengthMPMCList<Record,  STRESS_LIST_LEN > stress_list;
+
+static void check_stress( void );
+
+int main() {
+    int i = 0;
+    bool ok = true;
+    PRINTF("FixedLengthMPMCList test\n");
+
+    /* Test operations on an empty list */
+    CHECK( list.used() == 0, "Initial used()" );
+    CHECK( list.available() == LIST_LEN, "Initial available()" );
+    CHECK( list.pop(&i) == false, "pop() on empty list" );
+
+    CHECK( list.queue( 1 ),   "Initial queue()" );
+    CHECK( list.used() == 1, "used() after initial queue()" );
+    CHECK( list.pop( &i ) && i == 1, "pop() yielded correct value" );
+    CHECK( list.used() == 0, "used() after fully depleting pop" );
+    CHECK( list.pop(&i) == false, "pop() on empty list" );
+
+    /* Fill the list & test operations on a full list */
+    for( int n = 0; n < (int)LIST_LEN; n++ ) {
+        ok = ok && list.queue( 100 + n );
+    }
+    CHECK( ok, "queue() until full" );
+    CHECK( list.queue( 120 ) == false, "queue() on a full list" );
+    CHECK( list.available() == 0, "available() on full list" );
+    CHECK( list.used() == LIST_LEN, "used() on full list" );
+    CHECK( list.pop( &i ) && i == 100, "pop() from full list" );
+    CHECK( list.queue( 120 ), "queue() after pop() from full list" );
+
+    /* Cycle items through the list so that every item gets used as the
+       dummy */
+    for( int n = 1; n < 100; n++ ) {
+        ok = ok && list.pop( &i ) && ( i == 100 + n );
+        ok = ok && list.queue( 120 + n );
+    }
+    CHECK( ok, "FIFO order maintained while recycling items" );
+    CHECK( list.used() == LIST_LEN, "used() after recycling items" );
+
+    check_stress();
+
+    PRINTF("FixedLengthMPMCList test - Done\n");
+
+    return 0;
+}
+
+/* Several producers and consumers share a small list.  Every item must be
+   received exactly once, and items from any one producer must be received by
+   any one consumer in the order in which they were queued */
+static void check_stress( void )
+{
+    std::vector< std::thread > threads;
+    std::vector< std::atomic<unsigned> > received( STRESS_THREADS * STRESS_ITEMS );
+    std::atomic<unsigned> consumed( 0 );
+    std::atomic<bool> ordered( true );
+    std::atomic<bool> intact( true );
+
+    for( unsigned p = 0; p < STRESS_THREADS; p++ ) {
+        threads.push_back( std::thread( [p]() {
+            for( uint32_t n = 0; n < STRESS_ITEMS; n++ ) {
+                Record r = { p, n, p ^ ( n * 2654435761U ) };
+                while( !stress_list.queue( r ) ) {
+                    std::this_thread::yield();
+                }
+            }
+        } ) );
+    }
+
+    for( unsigned c = 0; c < STRESS_THREADS; c++ ) {
+        threads.push_back( std::thread( [&]() {
+            std::vector< int64_t > last( STRESS_THREADS, -1 );
+            while( consumed.load() < STRESS_THREADS * STRESS_ITEMS ) {
+                Record r;
+                if( stress_list.pop( &r ) ) {
+                    consumed.fetch_add( 1 );
+                    if( ( r.producer >= STRESS_THREADS ) || ( r.seq >= STRESS_ITEMS ) ||
+                        ( r.check != ( r.producer ^ ( r.seq * 2654435761U ) ) ) ) {
+                        intact = false;
+                    } else {
+                        if( (int64_t)r.seq <= last[ r.producer ] ) {
+                            ordered = false;
+                        }
+                        last[ r.producer ] = r.seq;
+                        received[ ( r.producer * STRESS_ITEMS ) + r.seq ].fetch_add( 1 );
+                    }
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        } ) );
+    }
+
+    for( size_t t = 0; t < threads.size(); t++ ) {
+        threads[ t ].join();
+    }
+
+    bool exactly_once = true;
+    for( size_t n = 0; n < received.size(); n++ ) {
+        if( received[ n ].load() != 1U ) {
+            exactly_once = false;
+        }
+    }
+
+    CHECK( intact.load(), "stress: items intact" );
+    CHECK( exactly_once, "stress: every item received exactly once" );
+    CHECK( ordered.load(), "stress: per-producer order maintained" );
+    CHECK( stress_list.used() == 0, "stress: list empty afterwards" );
+    CHECK( stress_list.available() == STRESS_LIST_LEN, "stress: all items returned to free stack" );
+}
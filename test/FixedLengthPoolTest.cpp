@@ -0,0 +1,189 @@
+/**
+   @file
+   @brief Tests for the FixedLengthPool and FixedLengthPoolList classes
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include "FixedLengthPool.hpp"
+
+#define POOL_LEN (8U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+/* Counts live instances, to check that items are destroyed */
+class Tracked
+{
+    public:
+        static int s_live;
+        int m_val;
+
+        Tracked( const int p_val = 0 ) : m_val( p_val ) { s_live++; }
+        Tracked( const Tracked& p_other ) : m_val( p_other.m_val ) { s_live++; }
+        ~Tracked() { s_live--; }
+        Tracked& operator=( const Tracked& p_other ) { m_val = p_other.m_val; return *this; }
+        bool operator==( const Tracked& p_other ) const { return m_val == p_other.m_val; }
+};
+
+int Tracked::s_live = 0;
+
+template < template < class, size_t > class Links > static void check_pool_links( const char* p_name );
+static void check_object_lifetime( void );
+
+int main() {
+    PRINTF("FixedLengthPool test\n");
+
+    check_pool_links< FixedLengthListSingleLinks >( "single" );
+    check_pool_links< FixedLengthListDoubleLinks >( "double" );
+    check_pool_links< FixedLengthListCompactSingleLinks >( "compact single" );
+    check_pool_links< FixedLengthListCompactDoubleLinks >( "compact double" );
+    check_object_lifetime();
+
+    PRINTF("FixedLengthPool test - Done\n");
+
+    return 0;
+}
+
+/* Compare a list's contents, front to back, with an array */
+template < class List > static bool contents_are( List& p_list, const int* const p_vals, const size_t p_count )
+{
+    bool ret_val = ( p_list.used() == p_count );
+    size_t i = 0;
+
+    for( typename List::iterator it = p_list.begin();
+         ret_val && ( it != p_list.end() );
+         ++it, i++ )
+    {
+        ret_val = ( i < p_count ) && ( *it == p_vals[ i ] );
+    }
+
+    return ret_val && ( i == p_count );
+}
+
+template < template < class, size_t > class Links > static void check_pool_links( const char* p_name )
+{
+    typedef FixedLengthPool< int, POOL_LEN, Links > pool_t;
+    typedef FixedLengthPoolList< int, POOL_LEN, Links > list_t;
+
+    pool_t pool;
+    list_t a( pool );
+    list_t b( pool );
+    int i = 0;
+
+    PRINTF( "Links: %s\n", p_name );
+
+    CHECK( pool.used() == 0 && pool.available() == POOL_LEN, "Initial pool used() & available()" );
+    CHECK( a.used() == 0 && a.available() == POOL_LEN, "Initial list used() & available()" );
+    CHECK( a.pop( &i ) == false && a.dequeue( &i ) == false, "pop() & dequeue() on empty list" );
+
+    /* Lists share the pool's budget */
+    for( int v = 1; v <= 5; v++ )
+    {
+        a.queue( v );
+    }
+    CHECK( a.push( 0 ) && b.queue( 10 ) && b.push( 9 ), "push() & queue() onto two lists" );
+    CHECK( pool.used() == 8 && a.available() == 0 && b.available() == 0, "available() shared between lists" );
+    CHECK( b.queue( 11 ) == false && a.push( -1 ) == false, "push() & queue() fail when pool exhausted" );
+
+    const int a_vals[] = { 0, 1, 2, 3, 4, 5 };
+    const int b_vals[] = { 9, 10 };
+    CHECK( contents_are( a, a_vals, 6 ) && contents_are( b, b_vals, 2 ), "list contents" );
+    CHECK( a.inList( 3 ) && !a.inList( 10 ) && b.inList( 10 ), "inList()" );
+
+    /* Freeing items in one list makes room in another */
+    CHECK( a.pop( &i ) && i == 0 && a.dequeue( &i ) && i == 5, "pop() & dequeue()" );
+    CHECK( a.remove( 3 ) && !a.remove( 3 ) && !a.inList( 3 ), "remove()" );
+    CHECK( pool.available() == 3 && b.queue( 11 ) && b.used() == 3, "queue() into space freed by other list" );
+
+    /* Items are moved between lists by relinking */
+    const int after_part[] = { 1, 2, 4, 9 };
+    const int b_rest[] = { 10, 11 };
+    CHECK( a.splice_back( b, 1 ) == 1 && contents_are( a, after_part, 4 ) && contents_are( b, b_rest, 2 ), "splice_back() part of list" );
+    const int after_all[] = { 1, 2, 4, 9, 10, 11 };
+    CHECK( a.splice_back( b ) == 2 && contents_are( a, after_all, 6 ) && b.used() == 0, "splice_back() whole list" );
+    CHECK( pool.used() == 6, "splice_back() uses no pool items" );
+    CHECK( b.splice_back( a, 100 ) == 6 && a.used() == 0 && contents_are( b, after_all, 6 ), "splice_back() count larger than list" );
+    CHECK( b.splice_back( b ) == 0 && b.splice_back( a ) == 0 && b.used() == 6, "splice_back() from self or empty list" );
+    CHECK( b.queue( 12 ) && b.dequeue( &i ) && i == 12 && b.dequeue( &i ) && i == 11, "queue() & dequeue() after splice_back()" );
+
+    /* A list on a different pool can't be spliced */
+    pool_t other_pool;
+    list_t c( other_pool );
+    c.queue( 99 );
+    CHECK( b.splice_back( c ) == 0 && c.used() == 1 && b.used() == 5, "splice_back() from list with different pool" );
+
+    b.clear();
+    CHECK( b.used() == 0 && pool.used() == 0 && pool.available() == POOL_LEN, "clear() returns items to pool" );
+    for( int v = 0; v < (int)POOL_LEN; v++ )
+    {
+        a.push( v );
+    }
+    CHECK( a.used() == POOL_LEN && a.available() == 0 && a.inList( 0 ) && a.inList( (int)POOL_LEN - 1 ), "whole pool usable after clear()" );
+
+    /* Raw use of the pool */
+    a.clear();
+    typename pool_t::link_t l = pool.allocate();
+    CHECK( l != pool_t::links_t::nil() && pool.used() == 1, "allocate()" );
+    pool.release( l );
+    CHECK( pool.used() == 0, "release()" );
+}
+
+static void check_object_lifetime( void )
+{
+    typedef FixedLengthPool< Tracked, POOL_LEN > pool_t;
+    typedef FixedLengthPoolList< Tracked, POOL_LEN > list_t;
+
+    pool_t pool;
+    Tracked t;
+
+    PRINTF( "Object lifetime\n" );
+
+    {
+        list_t a( pool );
+        list_t b( pool );
+
+        for( int v = 0; v < 6; v++ )
+        {
+            a.queue( Tracked( v ) );
+        }
+        b.queue( Tracked( 6 ) );
+        CHECK( Tracked::s_live == 8, "items constructed in pool" );
+
+        a.pop( &t );
+        b.remove( Tracked( 6 ) );
+        CHECK( Tracked::s_live == 6, "pop() & remove() destroy items" );
+
+        b.splice_back( a, 2 );
+        CHECK( Tracked::s_live == 6, "splice_back() neither copies nor destroys items" );
+
+        a.clear();
+        CHECK( Tracked::s_live == 3 && pool.used() == 2, "clear() destroys items" );
+    }
+
+    CHECK( Tracked::s_live == 1 && pool.used() == 0, "destructor destroys items and returns them to pool" );
+}
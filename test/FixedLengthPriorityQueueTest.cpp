@@ -0,0 +1,240 @@
+/**
+   @file
+   @brief Tests for the FixedLengthPriorityQueue class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include <functional>
+
+#include "FixedLengthPriorityQueue.hpp"
+
+#define QUEUE_LEN (20U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+typedef FixedLengthPriorityQueue<int, QUEUE_LEN > queue_t;
+
+queue_t pq;
+
+static void check_handles( void );
+static void check_against_reference( void );
+static void check_object_lifetime( void );
+
+int main() {
+    int i = 0;
+    queue_t::handle_t h;
+    PRINTF("FixedLengthPriorityQueue test\n");
+
+    /* Test operations on an empty queue */
+    CHECK( pq.used() == 0, "Initial used()" );
+    CHECK( pq.available() == QUEUE_LEN, "Initial available()" );
+    CHECK( pq.pop(&i) == false, "pop() on empty queue" );
+    CHECK( pq.peek(&i) == false, "peek() on empty queue" );
+
+    CHECK( pq.push( 50 ) && pq.push( 20 ) && pq.push( 80 ) && pq.push( 10 ), "push()" );
+    CHECK( pq.used() == 4, "used() after push()" );
+    CHECK( pq.peek( &i, &h ) && i == 10 && pq[ h ] == 10, "peek() yields smallest item" );
+    CHECK( pq.used() == 4, "peek() leaves item in queue" );
+    CHECK( pq.pop( &i ) && i == 10, "pop() yields smallest item" );
+    CHECK( pq.pop( &i ) && i == 20, "pop() yields next smallest item" );
+    CHECK( pq.push( 5 ) && pq.pop( &i ) && i == 5, "pop() after push() of new smallest item" );
+    CHECK( pq.pop( &i ) && i == 50 && pq.pop( &i ) && i == 80, "pop() remaining items" );
+    CHECK( pq.pop( &i ) == false && pq.used() == 0, "pop() on drained queue" );
+
+    /* Fill the queue, in descending order so that every push() sifts to the
+       root */
+    for( i = QUEUE_LEN; i > 0; i-- ) {
+        pq.push( i );
+    }
+    CHECK( pq.available() == 0, "available() on full queue" );
+    CHECK( pq.push( 0 ) == false, "push() on full queue" );
+    CHECK( pq.pop( &i ) && i == 1 && pq.push( 0 ) && pq.peek( &i ) && i == 0, "push() after pop() on full queue" );
+    pq.clear();
+    CHECK( pq.used() == 0 && pq.pop( &i ) == false, "clear()" );
+
+    /* Duplicates */
+    pq.push( 7 );
+    pq.push( 7 );
+    pq.push( 3 );
+    CHECK( pq.pop( &i ) && i == 3 && pq.pop( &i ) && i == 7 && pq.pop( &i ) && i == 7, "duplicate items" );
+
+    check_handles();
+    check_against_reference();
+    check_object_lifetime();
+
+    PRINTF("FixedLengthPriorityQueue test - Done\n");
+
+    return 0;
+}
+
+static void check_handles( void )
+{
+    queue_t::handle_t h[ 5 ];
+    int vals[ 5 ] = { 40, 10, 30, 50, 20 };
+    int i;
+
+    pq.clear();
+    for( int j = 0; j < 5; j++ ) {
+        pq.push( vals[ j ], &h[ j ] );
+    }
+
+    CHECK( pq.contains( h[ 0 ] ) && pq[ h[ 0 ] ] == 40 && pq[ h[ 3 ] ] == 50, "handles: operator[]" );
+    CHECK( pq.update( h[ 3 ], 5 ) && pq.peek( &i ) && i == 5, "handles: update() decrease key to front" );
+    CHECK( pq.update( h[ 1 ], 45 ) && pq[ h[ 1 ] ] == 45, "handles: update() increase key" );
+    CHECK( pq.remove( h[ 2 ], &i ) && i == 30 && !pq.contains( h[ 2 ] ), "handles: remove()" );
+    CHECK( pq.remove( h[ 2 ] ) == false && pq.update( h[ 2 ], 1 ) == false, "handles: stale handle rejected" );
+    CHECK( pq.pop( &i ) && i == 5 && !pq.contains( h[ 3 ] ), "handles: pop() releases handle" );
+    CHECK( pq.pop( &i ) && i == 20 && pq.pop( &i ) && i == 40 && pq.pop( &i ) && i == 45, "handles: order after update() & remove()" );
+    CHECK( !pq.contains( (queue_t::handle_t)( QUEUE_LEN - 1U ) ) && !pq.contains( queue_t::nil() ), "handles: unused handles" );
+
+    /* Copies keep the handles */
+    pq.push( 8, &h[ 0 ] );
+    pq.push( 9, &h[ 1 ] );
+    {
+        queue_t copy( pq );
+        CHECK( copy.contains( h[ 1 ] ) && copy[ h[ 1 ] ] == 9 && copy.update( h[ 1 ], 1 ) && copy.pop( &i ) && i == 1, "handles: copy" );
+        CHECK( pq.peek( &i ) && i == 8 && pq[ h[ 1 ] ] == 9, "handles: original unaffected by copy" );
+    }
+    pq.clear();
+}
+
+/* Apply the same pseudo-random sequence of operations to queues of
+   different arity and a sorted array, checking that they agree */
+template < size_t arity > static bool matches_reference( void )
+{
+    typedef FixedLengthPriorityQueue<int, 64U, std::greater<int>, arity > big_t;
+    big_t q;
+    typename big_t::handle_t handles[ 64 ];
+    int values[ 64 ];
+    bool live[ 64 ] = { false };
+    unsigned seed = 7U;
+    bool ok = true;
+
+    for( unsigned n = 0; n < 5000U; n++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+        unsigned r = seed >> 16;
+        int v = (int)( r % 1000U );
+        unsigned k = ( r >> 4 ) % 64U;
+        typename big_t::handle_t h;
+
+        switch( r % 4U )
+        {
+            case 0:
+            case 1:
+                if( q.push( v, &h ) ) {
+                    ok = ok && !live[ h ];
+                    handles[ h ] = h;
+                    values[ h ] = v;
+                    live[ h ] = true;
+                } else {
+                    ok = ok && ( q.used() == 64U );
+                }
+                break;
+            case 2:
+            {
+                /* Expect the largest live value */
+                int best = -1;
+                int got;
+                for( unsigned j = 0; j < 64U; j++ ) {
+                    if( live[ j ] && values[ j ] > best ) {
+                        best = values[ j ];
+                    }
+                }
+                if( q.peek( &got, &h ) ) {
+                    ok = ok && ( got == best ) && q.pop( &got ) && ( got == best );
+                    live[ h ] = false;
+                } else {
+                    ok = ok && ( best == -1 );
+                }
+                break;
+            }
+            default:
+                if( live[ k ] ) {
+                    if( v & 1 ) {
+                        ok = ok && q.update( handles[ k ], v );
+                        values[ k ] = v;
+                    } else {
+                        int got;
+                        ok = ok && q.remove( handles[ k ], &got ) && ( got == values[ k ] );
+                        live[ k ] = false;
+                    }
+                } else {
+                    ok = ok && !q.contains( (typename big_t::handle_t)k );
+                }
+                break;
+        }
+    }
+
+    return ok;
+}
+
+static void check_against_reference( void )
+{
+    CHECK( matches_reference< 2 >(), "binary heap agrees with reference" );
+    CHECK( matches_reference< 4 >(), "4-ary heap agrees with reference" );
+    CHECK( matches_reference< 7 >(), "7-ary heap agrees with reference" );
+}
+
+/* Item type with no default constructor which counts its instances */
+class Tracked
+{
+    public:
+        static int s_live;
+
+        int m_val;
+
+        explicit Tracked( int p_val ) : m_val( p_val ) { s_live++; }
+        Tracked( const Tracked& p_other ) : m_val( p_other.m_val ) { s_live++; }
+        Tracked& operator=( const Tracked& p_other ) { m_val = p_other.m_val; return *this; }
+        ~Tracked() { s_live--; }
+
+        bool operator<( const Tracked& p_other ) const { return m_val < p_other.m_val; }
+};
+
+int Tracked::s_live = 0;
+
+static void check_object_lifetime( void )
+{
+    Tracked out( 0 );
+    {
+        FixedLengthPriorityQueue<Tracked, 8U > tq;
+        CHECK( Tracked::s_live == 1, "lifetime: no items constructed by queue" );
+        for( int i = 8; i > 0; i-- ) {
+            tq.push( Tracked( i ) );
+        }
+        CHECK( Tracked::s_live == 9, "lifetime: push() constructs items" );
+        CHECK( tq.pop( &out ) && out.m_val == 1 && Tracked::s_live == 8, "lifetime: pop() destroys item" );
+        tq.clear();
+        CHECK( Tracked::s_live == 1, "lifetime: clear() destroys items" );
+        tq.push( Tracked( 3 ) );
+        tq.push( Tracked( 2 ) );
+    }
+    CHECK( Tracked::s_live == 1, "lifetime: destroying queue destroys items" );
+}
@@ -0,0 +1,189 @@
+/**
+   @file
+   @brief Tests for the FixedLengthRing class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include "FixedLengthRing.hpp"
+
+#define RING_LEN (20U)
+#define POW2_RING_LEN (16U)
+#define RING2_INI (17U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+int init_list[ RING2_INI ] = { 12, 23, 34, 45, 56, 67, 78, 89, 100, 111,
+                               122, 133, 144, 155, 166, 177, 188, };
+
+FixedLengthRing<int,  RING_LEN > ring;
+FixedLengthRing<int,  RING_LEN > ring2( init_list, RING2_INI );
+
+static void check_wrapping( void );
+static void check_iterators( void );
+
+int main() {
+    int i = 0;
+    PRINTF("FixedLengthRing test\n");
+
+    /* Test operations on an empty ring */
+    CHECK( ring.used() == 0, "Initial used()" );
+    CHECK( ring.inList(1) == false, "inList() on empty ring" );
+    CHECK( ring.available() == RING_LEN, "Initial available()" );
+    CHECK( ring.pop(&i) == false, "pop() on empty ring" );
+    CHECK( ring.dequeue(&i) == false, "dequeue() on empty ring" );
+
+    /* Push a little data into the ring, few tests, return to empty ring */
+    CHECK( ring.push( 1 ),   "Initial push()" );
+    CHECK( ring.inList(1) == true, "inList() for item which is in ring" );
+    CHECK( ring.inList(2) == false, "inList() for item which is not in ring" );
+    CHECK( ring.used() == 1, "used() after initial push()" );
+    CHECK( ring.pop( &i ),       "Check pop() returned OK" );
+    CHECK( i == 1,       "pop() yielded correct value" );
+    CHECK( ring.used() == 0, "used() after fully depleting pop" );
+
+    /* Push data onto an empty ring and then dequeue & pop it */
+    CHECK( ring.push( 22 ),   "push() 22 (getting some data in)" );
+    CHECK( ring.push( 33 ),   "push() 33 (getting some data in)" );
+    CHECK( ring.push( 44 ),   "push() 44 (getting some data in)" );
+    CHECK( ring.dequeue(&i) == true && i == 22, "dequeue() yielded correct value" );
+    CHECK( ring.dequeue(&i) == true && i == 33, "dequeue() yielded correct value" );
+    CHECK( ring.dequeue(&i) == true && i == 44, "dequeue() yielded correct value" );
+    CHECK( ring.pop(&i) == false, "pop() on empty ring" );
+    CHECK( ring.push( 55 ),   "push() 55 (getting some data in)" );
+    CHECK( ring.push( 66 ),   "push() 66 (getting some data in)" );
+    CHECK( ring.push( 77 ),   "push() 77 (getting some data in)" );
+    CHECK( ring.pop(&i) == true && i == 77, "pop() yielded correct value" );
+    CHECK( ring.dequeue(&i) == true && i == 55, "dequeue() yielded correct value" );
+    CHECK( ring.queue( 88 ),   "queue() 88 (getting some data in)" );
+    CHECK( ring.pop(&i) == true && i == 66, "pop() yielded correct value" );
+    CHECK( ring.pop(&i) == true && i == 88, "pop() yielded correct value" );
+    CHECK( ring.available() == RING_LEN, "available()" );
+
+    /* Fill the ring from both ends & test operations on a full ring */
+    for( int n = 0; n < 10; n++ ) {
+        ring.push( 109 - n );
+        ring.queue( 110 + n );
+    }
+    CHECK( ring.queue( 120 ) == false,   "queue() on a full ring" );
+    CHECK( ring.push( 120 ) == false,   "push() on a full ring" );
+    CHECK( ring.available() == 0, "available()" );
+    CHECK( ring.used() == RING_LEN, "used() on full ring" );
+    CHECK( ring.inList( 100 ) && ring.inList( 119 ), "inList() for items at either end of a full ring" );
+    CHECK( ring.pop(&i) == true && i == 100, "pop() from full ring" );
+    CHECK( ring.dequeue(&i) == true && i == 119, "dequeue() from full ring" );
+
+    /* Ring using the initialising constructor */
+    CHECK( ring2.available() == (RING_LEN-RING2_INI), "ring 2 available()" );
+    CHECK( ring2.used() == RING2_INI, "ring 2 used()" );
+    CHECK( ring2.pop(&i) == true && i == 12, "pop() yielded correct value" );
+    CHECK( ring2.dequeue(&i) == true && i == 188, "dequeue() yielded correct value" );
+    CHECK( ring2.queue( 199 ),   "queue() 199 (getting some data in)" );
+    CHECK( ring2.queue( 210 ),   "queue() 210 (getting some data in)" );
+    CHECK( ring2.queue( 221 ),   "queue() 221 (getting some data in)" );
+    CHECK( ring2.queue( 232 ),   "queue() 232 (getting some data in)" );
+    CHECK( ring2.queue( 243 ),   "queue() 243 (getting some data in)" );
+    CHECK( ring2.queue( 254 ) == false,   "queue() on a full ring" );
+
+    CHECK( ring2.remove( 255 ) == false,  "remove() a non-existant item" );
+    CHECK( ring2.remove( 243 ) == true,   "remove() item at end" );
+    CHECK( ring2.remove( 34 ) == true,    "remove() item near start" );
+    CHECK( ring2.remove( 166 ) == true,   "remove() item near end" );
+    CHECK( ring2.available() == 3, "available() having removed items from full ring" );
+    CHECK( ring2.inList( 243 ) == false,  "inList() for item which was just remove()d" );
+    CHECK( ring2.pop(&i) == true && i == 23, "pop() after remove() near start" );
+    CHECK( ring2.pop(&i) == true && i == 45, "pop() after remove() near start" );
+    CHECK( ring2.dequeue(&i) == true && i == 232, "dequeue() after remove() at end" );
+
+    check_wrapping();
+    check_iterators();
+
+    PRINTF("FixedLengthRing test - Done\n");
+
+    return 0;
+}
+
+static void check_wrapping( void )
+{
+    FixedLengthRing<int,  POW2_RING_LEN > pring;
+    int i = 0;
+    bool ok = true;
+
+    /* Cycle items through the ring enough times that head wraps repeatedly
+       in both directions */
+    for( int n = 0; n < 100; n++ ) {
+        ok = ok && pring.queue( n );
+        if( n >= (int)( POW2_RING_LEN / 2 ) ) {
+            ok = ok && pring.pop( &i ) && ( i == ( n - (int)( POW2_RING_LEN / 2 ) ) );
+        }
+    }
+    CHECK( ok, "power of two ring: FIFO order maintained while wrapping" );
+    CHECK( pring.used() == POW2_RING_LEN / 2, "power of two ring: used() after wrapping" );
+
+    pring.clear();
+    for( int n = 0; n < 100; n++ ) {
+        pring.push( n );
+        ok = ok && pring.dequeue( &i ) && ( i == n );
+    }
+    CHECK( ok, "power of two ring: LIFO from back maintained while wrapping" );
+    CHECK( pring.used() == 0, "power of two ring: empty after wrapping" );
+
+    for( int n = 0; n < (int)POW2_RING_LEN; n++ ) {
+        pring.push( n );
+    }
+    CHECK( pring.inList( 0 ) && pring.inList( POW2_RING_LEN - 1 ), "power of two ring: inList() across wrap" );
+    CHECK( pring.inList( POW2_RING_LEN ) == false, "power of two ring: inList() for item not in ring" );
+    CHECK( pring.remove( 7 ) && !pring.inList( 7 ), "power of two ring: remove() across wrap" );
+    CHECK( pring.dequeue( &i ) && i == 0, "power of two ring: dequeue() after remove()" );
+}
+
+static void check_iterators( void )
+{
+    FixedLengthRing<int,  RING_LEN > iring( init_list, RING2_INI );
+    FixedLengthRing<int,  RING_LEN >::iterator it;
+    int i;
+
+    /* Move the head so that iteration has to wrap */
+    iring.pop( &i );
+    iring.pop( &i );
+    iring.queue( 12 );
+    iring.queue( 23 );
+
+    it = iring.begin();
+    CHECK( *it     == init_list[2],   "iterators: begin()" );
+    CHECK( it      == iring.begin(),  "iterators: operator==" );
+    CHECK( it      != iring.end(),    "iterators: operator!=" );
+    CHECK( *(it++) == init_list[2],   "iterators: operator++ (post-increment)" );
+    CHECK( *it     == init_list[3],   "iterators: operator++ (post-increment)" );
+    CHECK( *(++it) == init_list[4],   "iterators: operator++ (pre-increment)" );
+    it+=13;
+    CHECK( *it     == 12,             "iterators: operator+= across wrap" );
+    it+=15;
+    CHECK( it      != iring.begin(),  "iterators: operator!=" );
+    CHECK( it      == iring.end(),    "iterators: operator+= stops at end()" );
+}
@@ -0,0 +1,112 @@
+/**
+   @file
+   @brief Tests for the FixedLengthSPSCQueue class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <thread>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+
+#include "FixedLengthSPSCQueue.hpp"
+
+#define QUEUE_LEN (20U)
+#define POW2_QUEUE_LEN (16U)
+#define TRANSFER_COUNT (1000000U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+FixedLengthSPSCQueue<int,  QUEUE_LEN > q;
+FixedLengthSPSCQueue<unsigned,  POW2_QUEUE_LEN > pq;
+
+static void check_threaded( void );
+
+int main() {
+    int i = 0;
+    bool ok = true;
+    PRINTF("FixedLengthSPSCQueue test\n");
+
+    /* Test operations on an empty queue */
+    CHECK( q.used() == 0, "Initial used()" );
+    CHECK( q.available() == QUEUE_LEN, "Initial available()" );
+    CHECK( q.pop(&i) == false, "pop() on empty queue" );
+
+    CHECK( q.queue( 1 ),   "Initial queue()" );
+    CHECK( q.used() == 1, "used() after initial queue()" );
+    CHECK( q.pop( &i ) && i == 1, "pop() yielded correct value" );
+    CHECK( q.used() == 0, "used() after fully depleting pop" );
+    CHECK( q.pop(&i) == false, "pop() on empty queue" );
+
+    /* Fill the queue & test operations on a full queue */
+    for( int n = 0; n < (int)QUEUE_LEN; n++ ) {
+        ok = ok && q.queue( 100 + n );
+    }
+    CHECK( ok, "queue() until full" );
+    CHECK( q.queue( 120 ) == false, "queue() on a full queue" );
+    CHECK( q.available() == 0, "available() on full queue" );
+    CHECK( q.used() == QUEUE_LEN, "used() on full queue" );
+    CHECK( q.pop( &i ) && i == 100, "pop() from full queue" );
+    CHECK( q.queue( 120 ), "queue() after pop() from full queue" );
+
+    /* Cycle items through the queue so that positions wrap a number of
+       times */
+    for( int n = 1; n < 100; n++ ) {
+        ok = ok && q.pop( &i ) && ( i == 100 + n );
+        ok = ok && q.queue( 120 + n );
+    }
+    CHECK( ok, "FIFO order maintained while wrapping" );
+    CHECK( q.used() == QUEUE_LEN, "used() after wrapping" );
+
+    check_threaded();
+
+    PRINTF("FixedLengthSPSCQueue test - Done\n");
+
+    return 0;
+}
+
+static void check_threaded( void )
+{
+    bool in_order = true;
+
+    /* Producer and consumer running concurrently - every item must arrive,
+       in order */
+    std::thread producer( []() {
+        for( unsigned n = 0; n < TRANSFER_COUNT; n++ ) {
+            while( !pq.queue( n ) ) {
+                std::this_thread::yield();
+            }
+        }
+    } );
+
+    for( unsigned n = 0; n < TRANSFER_COUNT; n++ ) {
+        unsigned v;
+        while( !pq.pop( &v ) ) {
+            std::this_thread::yield();
+        }
+        if( v != n ) {
+            in_order = false;
+        }
+    }
+
+    producer.join();
+
+    CHECK( in_order, "threaded: all items transferred in order" );
+    CHECK( pq.used() == 0, "threaded: queue empty after transfer" );
+}
@@ -0,0 +1,195 @@
+/**
+   @file
+   @brief Tests for the FixedLengthSharedList class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+
+#include "FixedLengthSharedList.hpp"
+
+#define LIST_LEN (16U)
+#define RECORD_COUNT (200000U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+/* Record passed between processes */
+struct Record
+{
+    uint32_t m_seq;
+    uint32_t m_check;
+    char     m_text[ 16 ];
+};
+
+static bool operator==( const Record& p_a, const Record& p_b )
+{
+    return ( p_a.m_seq == p_b.m_seq ) && ( p_a.m_check == p_b.m_check ) && ( memcmp( p_a.m_text, p_b.m_text, sizeof( p_a.m_text ) ) == 0 );
+}
+
+static Record make_record( const uint32_t p_seq )
+{
+    Record ret_val;
+    memset( &ret_val, 0, sizeof( ret_val ) );
+    ret_val.m_seq = p_seq;
+    ret_val.m_check = p_seq * 2654435761U;
+    snprintf( ret_val.m_text, sizeof( ret_val.m_text ), "rec %u", (unsigned)p_seq );
+    return ret_val;
+}
+
+typedef FixedLengthSharedList< Record, LIST_LEN > shared_t;
+
+/* Map the whole of the file open as p_fd */
+static void* map( const int p_fd )
+{
+    void* ret_val = mmap( NULL, sizeof( shared_t ), PROT_READ | PROT_WRITE, MAP_SHARED, p_fd, 0 );
+    return ( ret_val == MAP_FAILED ) ? NULL : ret_val;
+}
+
+static void check_views( const int p_fd );
+static void check_processes( const int p_fd );
+
+int main() {
+    char path[] = "/tmp/FixedLengthSharedListTestXXXXXX";
+    int fd = mkstemp( path );
+
+    PRINTF("FixedLengthSharedList test\n");
+
+    CHECK( ( fd >= 0 ) && ( ftruncate( fd, sizeof( shared_t ) ) == 0 ), "Create backing file" );
+    unlink( path );
+
+    check_views( fd );
+    check_processes( fd );
+
+    close( fd );
+
+    PRINTF("FixedLengthSharedList test - Done\n");
+
+    return 0;
+}
+
+/* Map the file twice, so that the list is seen at two different
+   addresses */
+static void check_views( const int p_fd )
+{
+    void* mem_a = map( p_fd );
+    void* mem_b = map( p_fd );
+    Record r;
+
+    CHECK( mem_a != NULL && mem_b != NULL && mem_a != mem_b, "Map file at two addresses" );
+
+    CHECK( shared_t::attach( mem_b, sizeof( shared_t ) ) == NULL, "attach() before create()" );
+    CHECK( shared_t::create( mem_a, sizeof( shared_t ) - 1U ) == NULL, "create() in too small a region" );
+    CHECK( shared_t::create( static_cast< char* >( mem_a ) + 1, sizeof( shared_t ) - 1U ) == NULL, "create() in misaligned region" );
+
+    shared_t* a = shared_t::create( mem_a, sizeof( shared_t ) );
+    shared_t* b = shared_t::attach( mem_b, sizeof( shared_t ) );
+
+    CHECK( a != NULL && b != NULL && a->used() == 0 && b->available() == LIST_LEN, "create() then attach()" );
+    CHECK( ( FixedLengthSharedList< Record, LIST_LEN / 2U >::attach( mem_b, sizeof( shared_t ) ) == NULL ), "attach() with wrong queueMax" );
+    CHECK( ( FixedLengthSharedList< uint32_t, LIST_LEN >::attach( mem_b, sizeof( shared_t ) ) == NULL ), "attach() with wrong type" );
+
+    a->queue( make_record( 1 ) );
+    a->queue( make_record( 2 ) );
+    a->push( make_record( 0 ) );
+    CHECK( b->used() == 3 && b->inList( make_record( 2 ) ), "Items added by one view seen by the other" );
+    CHECK( b->pop( &r ) && r == make_record( 0 ) && b->dequeue( &r ) && r == make_record( 2 ), "pop() & dequeue() by other view" );
+    CHECK( b->remove( make_record( 1 ) ) && a->used() == 0, "remove() by other view" );
+
+    for( uint32_t i = 0; i < LIST_LEN; i++ )
+    {
+        b->queue( make_record( i ) );
+    }
+    CHECK( !a->queue( make_record( 99 ) ) && a->available() == 0, "List full in both views" );
+
+    /* The list holds no addresses, so may be copied elsewhere */
+    {
+        void* copy = NULL;
+        bool ok = ( posix_memalign( &copy, alignof( shared_t ), sizeof( shared_t ) ) == 0 );
+        shared_t* c;
+
+        memcpy( copy, mem_a, sizeof( shared_t ) );
+        c = shared_t::attach( copy, sizeof( shared_t ) );
+        ok = ok && ( c != NULL ) && ( c->used() == LIST_LEN );
+        for( uint32_t i = 0; ok && ( i < LIST_LEN ); i++ )
+        {
+            ok = c->pop( &r ) && ( r == make_record( i ) );
+        }
+        CHECK( ok && a->used() == LIST_LEN, "Copy of list relocated with memcpy()" );
+        free( copy );
+    }
+
+    a->clear();
+    CHECK( b->used() == 0, "clear() seen by other view" );
+
+    munmap( mem_a, sizeof( shared_t ) );
+    munmap( mem_b, sizeof( shared_t ) );
+}
+
+/* A child process produces records while the parent consumes them */
+static void check_processes( const int p_fd )
+{
+    void* mem = map( p_fd );
+    shared_t* list = shared_t::attach( mem, sizeof( shared_t ) );
+    pid_t child;
+    Record r;
+    bool ok = ( list != NULL );
+    int status = -1;
+
+    child = fork();
+    if( child == 0 )
+    {
+        /* Map afresh, rather than using the mapping inherited from the
+           parent */
+        void* child_mem = map( p_fd );
+        shared_t* child_list = shared_t::attach( child_mem, sizeof( shared_t ) );
+        bool child_ok = ( child_list != NULL );
+
+        for( uint32_t i = 0; child_ok && ( i < RECORD_COUNT ); i++ )
+        {
+            while( !child_list->queue( make_record( i ) ) )
+            {
+                std::this_thread::yield();
+            }
+        }
+        _exit( child_ok ? 0 : 1 );
+    }
+
+    for( uint32_t i = 0; ok && ( i < RECORD_COUNT ); i++ )
+    {
+        while( !list->pop( &r ) )
+        {
+            std::this_thread::yield();
+        }
+        ok = ( r == make_record( i ) );
+    }
+
+    ok = ok && ( child > 0 ) && ( waitpid( child, &status, 0 ) == child );
+
+    CHECK( ok && WIFEXITED( status ) && WEXITSTATUS( status ) == 0, "Records passed between processes in order" );
+    CHECK( list != NULL && list->used() == 0, "List empty after transfer" );
+
+    munmap( mem, sizeof( shared_t ) );
+}
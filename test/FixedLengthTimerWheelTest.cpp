@@ -0,0 +1,247 @@
+/**
+   @file
+   @brief Tests for the FixedLengthTimerWheel class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include "FixedLengthTimerWheel.hpp"
+
+#define WHEEL_LEN (8U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+/* Counts live instances, to check that items are destroyed */
+class Tracked
+{
+    public:
+        static int s_live;
+        int m_val;
+
+        Tracked( const int p_val = 0 ) : m_val( p_val ) { s_live++; }
+        Tracked( const Tracked& p_other ) : m_val( p_other.m_val ) { s_live++; }
+        ~Tracked() { s_live--; }
+        Tracked& operator=( const Tracked& p_other ) { m_val = p_other.m_val; return *this; }
+};
+
+int Tracked::s_live = 0;
+
+static void check_basic( void );
+static void check_cancel( void );
+static void check_levels( void );
+static void check_object_lifetime( void );
+
+int main() {
+    PRINTF("FixedLengthTimerWheel test\n");
+
+    check_basic();
+    check_cancel();
+    check_levels();
+    check_object_lifetime();
+
+    PRINTF("FixedLengthTimerWheel test - Done\n");
+
+    return 0;
+}
+
+static void check_basic( void )
+{
+    typedef FixedLengthTimerWheel< int, WHEEL_LEN > wheel_t;
+
+    wheel_t wheel;
+    int i = 0;
+
+    PRINTF( "Basic\n" );
+
+    CHECK( wheel.used() == 0 && wheel.available() == WHEEL_LEN && wheel.now() == 0, "Initial used(), available() & now()" );
+    CHECK( wheel.expired( &i ) == false && wheel.tick() == 0 && wheel.now() == 1, "tick() on empty wheel" );
+
+    CHECK( wheel.schedule( 3, 3 ) && wheel.schedule( 1, 1 ) && wheel.schedule( 2, 2 ), "schedule()" );
+    CHECK( wheel.used() == 3 && wheel.available() == WHEEL_LEN - 3, "used() & available() after schedule()" );
+    CHECK( wheel.tick() == 1 && wheel.expired( &i ) && i == 1 && !wheel.expired( &i ), "tick() expires first timer" );
+    CHECK( wheel.tick() == 1 && wheel.tick() == 1, "tick() expires remaining timers" );
+    CHECK( wheel.expired( &i ) && i == 2 && wheel.expired( &i ) && i == 3 && wheel.used() == 0, "expired() in order of expiry" );
+
+    CHECK( wheel.schedule( 9, 0 ) && wheel.expired( &i ) && i == 9, "schedule() with no delay expires immediately" );
+
+    for( int v = 0; v < (int)WHEEL_LEN; v++ )
+    {
+        wheel.schedule( v, 5U + (wheel_t::tick_t)v );
+    }
+    CHECK( wheel.schedule( 99, 1 ) == false && wheel.available() == 0, "schedule() on full wheel" );
+    CHECK( wheel.advance( 4 ) == 0 && wheel.advance( 2 ) == 2, "advance()" );
+    CHECK( wheel.expired( NULL ) && wheel.expired( NULL ) && !wheel.expired( NULL ), "expired() with NULL" );
+    CHECK( wheel.schedule( 99, 1 ), "schedule() into space freed by expired()" );
+    wheel.clear();
+    CHECK( wheel.used() == 0 && wheel.advance( 100 ) == 0 && !wheel.expired( &i ), "clear()" );
+}
+
+static void check_cancel( void )
+{
+    typedef FixedLengthTimerWheel< int, WHEEL_LEN > wheel_t;
+
+    wheel_t wheel;
+    wheel_t::handle_t a, b, c, none;
+    int i = 0;
+
+    PRINTF( "Cancel\n" );
+
+    CHECK( !wheel.pending( none ) && !wheel.cancel( none ), "cancel() of default handle" );
+
+    wheel.schedule( 1, 10, &a );
+    wheel.schedule( 2, 10, &b );
+    wheel.schedule( 3, 1000, &c );
+    CHECK( wheel.pending( a ) && wheel.pending( b ) && wheel.pending( c ), "pending() after schedule()" );
+    CHECK( wheel.cancel( b, &i ) && i == 2 && !wheel.pending( b ) && wheel.used() == 2, "cancel() yields item" );
+    CHECK( !wheel.cancel( b ), "cancel() twice" );
+    CHECK( wheel.cancel( c ) && wheel.advance( 2000 ) == 1, "cancel() of timer in higher level" );
+
+    /* Expired, but not yet taken */
+    CHECK( !wheel.pending( a ) && wheel.cancel( a, &i ) && i == 1 && !wheel.expired( &i ), "cancel() of expired timer" );
+
+    /* Handle to a slot which has since been re-used */
+    wheel.schedule( 4, 1, &a );
+    wheel.tick();
+    wheel.expired( &i );
+    wheel.schedule( 5, 1, &b );
+    CHECK( !wheel.cancel( a ) && wheel.pending( b ), "cancel() of stale handle" );
+    CHECK( wheel.tick() == 1 && wheel.expired( &i ) && i == 5, "timer unaffected by stale handle" );
+
+    /* Cancel from the middle of the expired queue */
+    wheel.schedule( 6, 1 );
+    wheel.schedule( 7, 1, &a );
+    wheel.schedule( 8, 1 );
+    wheel.tick();
+    CHECK( wheel.cancel( a ) && wheel.expired( &i ) && i != 7 && wheel.expired( &i ) && i != 7 && !wheel.expired( &i ), "cancel() from expired queue" );
+}
+
+/* Schedule timers with pseudo-random delays on a small wheel, so that
+   timers pass through every level and beyond, checking that each expires
+   on exactly the right tick */
+template < size_t wheelSlots, size_t wheelLevels > static bool expires_on_time( const unsigned p_maxDelay )
+{
+    typedef FixedLengthTimerWheel< unsigned, 32U, wheelSlots, wheelLevels > wheel_t;
+
+    wheel_t wheel;
+    typename wheel_t::handle_t handles[ 32 ];
+    unsigned expiry[ 32 ];
+    bool live[ 32 ] = { false };
+    unsigned seed = 5U;
+    bool ok = true;
+
+    for( unsigned n = 0; n < 20000U; n++ )
+    {
+        unsigned id;
+        seed = seed * 1103515245U + 12345U;
+        id = ( seed >> 16 ) % 32U;
+
+        if( !live[ id ] )
+        {
+            unsigned delay = ( seed >> 8 ) % p_maxDelay;
+            ok = ok && wheel.schedule( id, delay, &( handles[ id ] ) );
+            expiry[ id ] = wheel.now() + delay;
+            live[ id ] = true;
+        }
+        else if( ( ( seed >> 4 ) & 7U ) == 0U )
+        {
+            ok = ok && wheel.cancel( handles[ id ] );
+            live[ id ] = false;
+        }
+
+        /* Collect timers with no delay, then those expiring on the next
+           tick */
+        for( unsigned t = 0; t < 2U; t++ )
+        {
+            while( wheel.expired( &id ) )
+            {
+                ok = ok && live[ id ] && ( expiry[ id ] == wheel.now() );
+                live[ id ] = false;
+            }
+            if( t == 0U )
+            {
+                wheel.tick();
+            }
+        }
+
+        /* Nothing overdue is left behind */
+        for( unsigned k = 0; k < 32U; k++ )
+        {
+            ok = ok && !( live[ k ] && ( expiry[ k ] < wheel.now() ) );
+        }
+    }
+
+    return ok;
+}
+
+static void check_levels( void )
+{
+    PRINTF( "Levels\n" );
+
+    CHECK( ( expires_on_time< 4U, 1U >( 4U ) ), "single level" );
+    CHECK( ( expires_on_time< 4U, 3U >( 64U ) ), "three levels, within range" );
+    CHECK( ( expires_on_time< 4U, 3U >( 500U ) ), "three levels, beyond range" );
+    CHECK( ( expires_on_time< 8U, 2U >( 200U ) ), "two levels, beyond range" );
+    CHECK( ( expires_on_time< 64U, 4U >( 100000U ) ), "default size" );
+
+    FixedLengthTimerWheel< int, 4U, 4U, 2U > wheel;
+    int i = 0;
+    wheel.schedule( 1, 1000U );
+    CHECK( wheel.advance( 999U ) == 0 && wheel.tick() == 1 && wheel.expired( &i ) && i == 1, "timer well beyond range" );
+}
+
+static void check_object_lifetime( void )
+{
+    typedef FixedLengthTimerWheel< Tracked, WHEEL_LEN > wheel_t;
+
+    Tracked t;
+
+    PRINTF( "Object lifetime\n" );
+
+    {
+        wheel_t wheel;
+        wheel_t::handle_t h;
+
+        CHECK( Tracked::s_live == 1, "no items constructed by wheel" );
+        wheel.schedule( Tracked( 1 ), 1 );
+        wheel.schedule( Tracked( 2 ), 2, &h );
+        wheel.schedule( Tracked( 3 ), 300 );
+        wheel.schedule( Tracked( 4 ), 5 );
+        CHECK( Tracked::s_live == 5, "schedule() copies items" );
+        wheel.cancel( h );
+        wheel.tick();
+        wheel.expired( &t );
+        CHECK( Tracked::s_live == 3 && t.m_val == 1, "cancel() & expired() destroy items" );
+        wheel.tick();
+        wheel.tick();
+        wheel.tick();
+        wheel.tick();
+        CHECK( Tracked::s_live == 3, "expiry neither copies nor destroys items" );
+    }
+
+    CHECK( Tracked::s_live == 1, "destructor destroys items" );
+}
@@ -0,0 +1,175 @@
+/**
+   @file
+   @brief Tests for the FixedLengthWorkStealingDeque class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+
+#include "FixedLengthWorkStealingDeque.hpp"
+
+#define DEQUE_LEN (20U)
+#define POW2_DEQUE_LEN (16U)
+#define THIEVES (3U)
+#define TASK_COUNT (1000000U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+FixedLengthWorkStealingDeque<int,  DEQUE_LEN > d;
+FixedLengthWorkStealingDeque<unsigned,  POW2_DEQUE_LEN > pd;
+
+/* Item larger than one atomic word */
+struct Wide
+{
+    unsigned m_a;
+    unsigned m_b;
+    unsigned m_c;
+};
+
+static void check_wide( void );
+static void check_threaded( void );
+
+int main() {
+    int i = 0;
+    bool ok = true;
+    PRINTF("FixedLengthWorkStealingDeque test\n");
+
+    /* Test operations on an empty deque */
+    CHECK( d.used() == 0, "Initial used()" );
+    CHECK( d.available() == DEQUE_LEN, "Initial available()" );
+    CHECK( d.pop( &i ) == false, "pop() on empty deque" );
+    CHECK( d.dequeue( &i ) == false, "dequeue() on empty deque" );
+
+    CHECK( d.push( 1 ),   "Initial push()" );
+    CHECK( d.used() == 1, "used() after initial push()" );
+    CHECK( d.pop( &i ) && i == 1, "pop() yielded correct value" );
+    CHECK( d.pop( &i ) == false && d.used() == 0, "pop() on emptied deque" );
+
+    CHECK( d.push( 2 ) && d.push( 3 ) && d.push( 4 ), "push() several items" );
+    CHECK( d.pop( &i ) && i == 4, "pop() takes newest item" );
+    CHECK( d.dequeue( &i ) && i == 2, "dequeue() takes oldest item" );
+    CHECK( d.dequeue( &i ) && i == 3 && d.dequeue( &i ) == false && d.pop( &i ) == false, "dequeue() last item" );
+    i = -1;
+    CHECK( d.pop( &i ) == false && d.dequeue( &i ) == false && i == -1, "failed pop() & dequeue() leave item untouched" );
+
+    /* Fill the deque & test operations on a full deque */
+    for( int n = 0; n < (int)DEQUE_LEN; n++ ) {
+        ok = ok && d.push( 100 + n );
+    }
+    CHECK( ok, "push() until full" );
+    CHECK( d.push( 120 ) == false, "push() on a full deque" );
+    CHECK( d.available() == 0 && d.used() == DEQUE_LEN, "used() & available() on full deque" );
+    CHECK( d.dequeue( &i ) && i == 100 && d.push( 120 ), "push() after dequeue() from full deque" );
+
+    /* Cycle items through the deque so that positions wrap a number of
+       times */
+    for( int n = 1; n < 100; n++ ) {
+        ok = ok && d.dequeue( &i ) && ( i == 100 + n );
+        ok = ok && d.push( 120 + n );
+    }
+    CHECK( ok, "FIFO order from dequeue() maintained while wrapping" );
+    for( int n = 99; ok && ( n >= 80 ); n-- ) {
+        ok = d.pop( &i ) && ( i == 120 + n );
+    }
+    CHECK( ok && d.used() == 0, "LIFO order from pop() maintained while wrapping" );
+
+    check_wide();
+    check_threaded();
+
+    PRINTF("FixedLengthWorkStealingDeque test - Done\n");
+
+    return 0;
+}
+
+static void check_wide( void )
+{
+    FixedLengthWorkStealingDeque< Wide, 4U > wd;
+    Wide w = { 1U, 2U, 3U };
+    Wide out = { 0U, 0U, 0U };
+
+    wd.push( w );
+    w.m_c = 4U;
+    wd.push( w );
+    CHECK( wd.dequeue( &out ) && out.m_a == 1U && out.m_b == 2U && out.m_c == 3U, "multi-word item dequeue()" );
+    CHECK( wd.pop( &out ) && out.m_c == 4U, "multi-word item pop()" );
+}
+
+static void check_threaded( void )
+{
+    static std::atomic<unsigned char> taken[ TASK_COUNT ];
+    std::atomic<unsigned> stolen( 0U );
+    std::atomic<bool> done( false );
+    std::vector< std::thread > thieves;
+    unsigned popped = 0U;
+    bool once = true;
+
+    for( unsigned n = 0; n < TASK_COUNT; n++ ) {
+        taken[ n ].store( 0U, std::memory_order_relaxed );
+    }
+
+    /* Thieves take from the back while the owner pushes and pops at the
+       front - every item must be taken exactly once */
+    for( unsigned t = 0; t < THIEVES; t++ ) {
+        thieves.push_back( std::thread( [&]() {
+            unsigned v;
+            while( !done.load( std::memory_order_acquire ) || ( pd.used() != 0 ) ) {
+                if( pd.dequeue( &v ) ) {
+                    taken[ v ].fetch_add( 1U, std::memory_order_relaxed );
+                    stolen.fetch_add( 1U, std::memory_order_relaxed );
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        } ) );
+    }
+
+    for( unsigned n = 0; n < TASK_COUNT; n++ ) {
+        unsigned v;
+        while( !pd.push( n ) ) {
+            if( pd.pop( &v ) ) {
+                taken[ v ].fetch_add( 1U, std::memory_order_relaxed );
+                popped++;
+            }
+        }
+        /* Keep the deque short, so that the owner and thieves often race
+           for the last item */
+        if( ( ( n & 3U ) == 0U ) && pd.pop( &v ) ) {
+            taken[ v ].fetch_add( 1U, std::memory_order_relaxed );
+            popped++;
+        }
+    }
+    done.store( true, std::memory_order_release );
+
+    for( size_t t = 0; t < thieves.size(); t++ ) {
+        thieves[ t ].join();
+    }
+
+    for( unsigned n = 0; n < TASK_COUNT; n++ ) {
+        once = once && ( taken[ n ].load( std::memory_order_relaxed ) == 1U );
+    }
+
+    CHECK( once, "threaded: every item taken exactly once" );
+    CHECK( popped + stolen.load() == TASK_COUNT && stolen.load() > 0U, "threaded: items both popped and stolen" );
+    CHECK( pd.used() == 0, "threaded: deque empty after transfer" );
+}
@@ -0,0 +1,225 @@
+/**
+   @file
+   @brief Tests for the FixedPoolAllocator class
+
+   @author John Bailey
+
+   @copyright Copyright 2026 John Bailey
+
+   @section LICENSE
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#if defined __CC_ARM
+#include "mbed.h"
+Serial pc(USBTX, USBRX); // tx, rx
+#define PRINTF( ... ) pc.printf(__VA_ARGS__)
+#else
+#include <stdio.h>
+#define PRINTF( ... ) printf(__VA_ARGS__)
+#endif
+
+#include <stdlib.h>
+#include <list>
+#include <map>
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#endif
+
+#include "FixedPoolAllocator.hpp"
+
+#define POOL_LEN (16U)
+#define CHECK( _x, ... ) do { PRINTF( __VA_ARGS__ ); if( _x ) { PRINTF(" OK\r\n"); } else { PRINTF(" FAILED!\r\n"); } } while( 0 )
+
+typedef FixedPoolAllocator< int, POOL_LEN > int_alloc_t;
+
+/* Count use of the heap, to check that containers use only the pools */
+static size_t s_heap = 0;
+
+#if __cplusplus >= 201103L
+void* operator new( size_t p_size )
+#else
+void* operator new( size_t p_size ) throw( std::bad_alloc )
+#endif
+{
+    s_heap++;
+    return malloc( p_size );
+}
+
+void operator delete( void* p_ptr ) throw()
+{
+    free( p_ptr );
+}
+
+#if defined __cpp_sized_deallocation
+void operator delete( void* p_ptr, size_t p_size ) throw()
+{
+    free( p_ptr );
+}
+#endif
+
+static void check_raw( void );
+static void check_list( void );
+static void check_map( void );
+static void check_unordered_map( void );
+
+int main() {
+    PRINTF("FixedPoolAllocator test\n");
+
+    check_raw();
+    check_list();
+    check_map();
+    check_unordered_map();
+
+    PRINTF("FixedPoolAllocator test - Done\n");
+
+    return 0;
+}
+
+static void check_raw( void )
+{
+    int_alloc_t a;
+    int* p[ POOL_LEN ];
+    bool distinct = true;
+
+    PRINTF( "Raw allocation\n" );
+
+    CHECK( int_alloc_t::used() == 0 && int_alloc_t::available() == POOL_LEN, "Initial used() & available()" );
+
+    for( size_t i = 0; i < POOL_LEN; i++ )
+    {
+        p[ i ] = a.allocate( 1 );
+        *p[ i ] = (int)i;
+        for( size_t j = 0; j < i; j++ )
+        {
+            distinct = distinct && ( p[ i ] != p[ j ] );
+        }
+    }
+    CHECK( distinct && int_alloc_t::used() == POOL_LEN && int_alloc_t::overflows() == 0, "allocate() whole pool" );
+
+    int* extra = a.allocate( 1 );
+    CHECK( extra != NULL && int_alloc_t::overflows() == 1 && int_alloc_t::used() == POOL_LEN, "allocate() on exhausted pool uses heap" );
+    a.deallocate( extra, 1 );
+    CHECK( int_alloc_t::used() == POOL_LEN, "deallocate() of heap object leaves pool untouched" );
+
+    a.deallocate( p[ 3 ], 1 );
+    CHECK( int_alloc_t::used() == POOL_LEN - 1 && a.allocate( 1 ) == p[ 3 ], "deallocate() returns object to pool for reuse" );
+
+    int* arr = a.allocate( 4 );
+    CHECK( arr != NULL && int_alloc_t::overflows() == 2, "allocate() of several objects uses heap" );
+    a.deallocate( arr, 4 );
+
+    for( size_t i = 0; i < POOL_LEN; i++ )
+    {
+        a.deallocate( p[ i ], 1 );
+    }
+    CHECK( int_alloc_t::used() == 0, "deallocate() whole pool" );
+
+    FixedPoolAllocator< long, POOL_LEN > b( a );
+    CHECK( a == b && !( a != b ), "rebound allocators compare equal" );
+    CHECK( ( FixedPoolAllocator< long, POOL_LEN >::available() == POOL_LEN ), "each type has its own pool" );
+}
+
+static void check_list( void )
+{
+    typedef std::list< int, int_alloc_t > list_t;
+
+    PRINTF( "std::list\n" );
+
+    size_t heap = s_heap;
+    {
+        list_t l;
+        for( int i = 0; i < 10; i++ )
+        {
+            l.push_back( i );
+        }
+        int sum = 0;
+        for( list_t::const_iterator it = l.begin(); it != l.end(); ++it )
+        {
+            sum += *it;
+        }
+        CHECK( l.size() == 10 && sum == 45, "std::list contents" );
+
+        list_t m;
+        m.splice( m.end(), l );
+        CHECK( m.size() == 10 && l.empty(), "std::list splice()" );
+        m.remove( 4 );
+        CHECK( m.size() == 9, "std::list remove()" );
+        CHECK( s_heap == heap, "std::list does not use heap" );
+    }
+}
+
+static void check_map( void )
+{
+    typedef std::pair< const int, int > entry_t;
+    typedef std::map< int, int, std::less< int >, FixedPoolAllocator< entry_t, POOL_LEN > > map_t;
+
+    PRINTF( "std::map\n" );
+
+    unsigned seed = 7U;
+    bool ok = true;
+    map_t m;
+    size_t heap = s_heap;
+
+    for( unsigned n = 0; n < 2000U; n++ )
+    {
+        seed = seed * 1103515245U + 12345U;
+        int key = (int)( ( seed >> 16 ) % POOL_LEN );
+
+        if( ( seed >> 12 ) & 1U )
+        {
+            m[ key ] = (int)n;
+        }
+        else
+        {
+            m.erase( key );
+        }
+        ok = ok && ( m.size() <= POOL_LEN );
+    }
+    CHECK( ok, "std::map insert() & erase()" );
+    CHECK( s_heap == heap, "std::map does not use heap" );
+
+    map_t copy( m );
+    CHECK( copy == m, "std::map copy" );
+    m.clear();
+    copy.clear();
+    CHECK( m.empty() && m.find( 1 ) == m.end(), "std::map clear()" );
+}
+
+static void check_unordered_map( void )
+{
+#if __cplusplus >= 201103L
+    typedef std::pair< const int, int > entry_t;
+    typedef std::unordered_map< int, int, std::hash< int >, std::equal_to< int >, FixedPoolAllocator< entry_t, POOL_LEN > > map_t;
+
+    PRINTF( "std::unordered_map\n" );
+
+    map_t m;
+    m.reserve( POOL_LEN );
+    size_t heap = s_heap;
+
+    for( int i = 0; i < (int)POOL_LEN; i++ )
+    {
+        m.emplace( i, i * 10 );
+    }
+    CHECK( m.size() == POOL_LEN && m.at( 7 ) == 70, "std::unordered_map emplace()" );
+    for( int i = 0; i < (int)POOL_LEN; i += 2 )
+    {
+        m.erase( i );
+    }
+    CHECK( m.size() == POOL_LEN / 2 && m.count( 2 ) == 0 && m.count( 3 ) == 1, "std::unordered_map erase()" );
+    CHECK( s_heap == heap, "std::unordered_map does not use heap after reserve()" );
+#endif
+}